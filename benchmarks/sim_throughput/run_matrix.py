@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""
+Simulator throughput benchmark for SST/macro.
+
+Runs a fixed matrix of network models x topologies x skeleton apps
+and collects the --sim-stats output of every run
+(events, events/sec, wall time per simulated second, peak RSS,
+per-phase startup time) into a single JSON and CSV file.
+Only the serial event manager is measured, the native backend does
+not run with sst_nthread > 1.
+
+usage: run_matrix.py [--sstmac PATH] [--out PREFIX]
+                     [--models m1,m2] [--topologies t1,t2] [--apps a1,a2]
+                     [--repeat N]
+"""
+
+import argparse
+import csv
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+models = ["pisces", "snappr", "sculpin", "logp"]
+topologies = ["torus", "dragonfly", "fat_tree"]
+apps = ["offered_load", "halo3d-26", "sweep3d"]
+
+csv_fields = [
+  "model", "topology", "app", "repeat", "status",
+  "simulated_time", "events", "events_per_sec", "wall_per_sim_sec",
+  "peak_rss_kb", "params", "setup", "run", "finish", "total_wall",
+]
+
+here = os.path.dirname(os.path.abspath(__file__))
+
+def splitList(arg, default):
+  if not arg:
+    return default
+  return arg.split(",")
+
+def runOne(sstmac, model, topo, app):
+  fd, stats_file = tempfile.mkstemp(suffix=".json")
+  os.close(fd)
+  cmd = [sstmac,
+         "-f", os.path.join(here, "app_%s.ini" % app),
+         "-i", os.path.join(here, "net_%s.ini" % model),
+         "-i", os.path.join(here, "topo_%s.ini" % topo),
+         "--no-wall-time",
+         "--sim-stats", stats_file]
+
+  start = time.time()
+  proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                        universal_newlines=True)
+  total = time.time() - start
+
+  result = {"status": "ok", "total_wall": total, "command": " ".join(cmd)}
+  if proc.returncode != 0:
+    result["status"] = "failed"
+    result["returncode"] = proc.returncode
+    result["output"] = proc.stdout[-2000:]
+  else:
+    with open(stats_file) as f:
+      result.update(json.load(f))
+  os.remove(stats_file)
+  return result
+
+def flatten(entry):
+  row = {}
+  for key in csv_fields:
+    if key in entry:
+      row[key] = entry[key]
+    elif key in entry.get("phases", {}):
+      row[key] = entry["phases"][key]
+    else:
+      row[key] = ""
+  return row
+
+def main():
+  parser = argparse.ArgumentParser(description="SST/macro simulator throughput matrix")
+  parser.add_argument("--sstmac", default="sstmac", help="sstmac executable")
+  parser.add_argument("--out", default="sim_throughput", help="prefix for the .json/.csv results")
+  parser.add_argument("--models", help="comma-separated subset of %s" % ",".join(models))
+  parser.add_argument("--topologies", help="comma-separated subset of %s" % ",".join(topologies))
+  parser.add_argument("--apps", help="comma-separated subset of %s" % ",".join(apps))
+  parser.add_argument("--repeat", type=int, default=1, help="runs per configuration")
+  args = parser.parse_args()
+
+  results = []
+  for model in splitList(args.models, models):
+    for topo in splitList(args.topologies, topologies):
+      for app in splitList(args.apps, apps):
+        for rep in range(args.repeat):
+          entry = runOne(args.sstmac, model, topo, app)
+          entry.update(model=model, topology=topo, app=app, repeat=rep)
+          results.append(entry)
+          sys.stdout.write("%-8s %-10s %-13s %-7s %12s events %12.1f events/s\n" %
+            (model, topo, app, entry["status"], entry.get("events", "-"),
+             entry.get("events_per_sec", 0)))
+          sys.stdout.flush()
+
+  with open(args.out + ".json", "w") as f:
+    json.dump(results, f, indent=2)
+
+  with open(args.out + ".csv", "w") as f:
+    writer = csv.DictWriter(f, fieldnames=csv_fields)
+    writer.writeheader()
+    for entry in results:
+      writer.writerow(flatten(entry))
+
+  failed = [r for r in results if r["status"] != "ok"]
+  return 1 if failed and len(failed) == len(results) else 0
+
+if __name__ == "__main__":
+  sys.exit(main())
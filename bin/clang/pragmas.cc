@@ -733,6 +733,76 @@ SSTBlockingPragma::activate(Stmt* s)
   CompilerGlobals::rewriter.InsertText(getStart(s), text, false, false);
 }
 
+SSTSampleLoopPragma::SSTSampleLoopPragma(SourceLocation loc, std::map<std::string, std::list<std::string>>&& args)
+ : detail_("5"),
+   skip_("50"),
+   resample_("3"),
+   tolerance_("0.05")
+{
+  for (auto& pair : args){
+    if (pair.second.empty()){
+      std::string err = "sample pragma keyword " + pair.first + " needs a value";
+      errorAbort(loc, err);
+    }
+    if (pair.first == "detail"){
+      detail_ = pair.second.front();
+    } else if (pair.first == "skip"){
+      skip_ = pair.second.front();
+    } else if (pair.first == "resample"){
+      resample_ = pair.second.front();
+    } else if (pair.first == "tolerance"){
+      tolerance_ = pair.second.front();
+    } else {
+      std::string err = "got invalid keyword in sample pragma: " + pair.first;
+      errorAbort(loc, err);
+    }
+  }
+}
+
+void
+SSTSampleLoopPragma::activate(Stmt* s)
+{
+  //a skipped iteration never runs the body, so only a loop that advances
+  //in its header can be sampled - a while loop would fast-forward forever
+  Stmt* body = nullptr;
+  switch (s->getStmtClass()){
+    case Stmt::ForStmtClass: {
+      ForStmt* fs = cast<ForStmt>(s);
+      if (!fs->getInc()){
+        errorAbort(s, "sample pragma requires the for loop increment in the loop header");
+      }
+      body = fs->getBody();
+      break;
+    }
+    case Stmt::CXXForRangeStmtClass:
+      body = cast<CXXForRangeStmt>(s)->getBody();
+      break;
+    default:
+      errorAbort(s, "sample pragma must be applied to a for loop, not a while or do loop");
+  }
+  if (body->getStmtClass() != Stmt::CompoundStmtClass){
+    errorAbort(s, "sample pragma requires the loop body to be in braces");
+  }
+
+  PresumedLoc ploc = CompilerGlobals::SM().getPresumedLoc(getStart(s));
+  std::stringstream id;
+  id << "\"" << ploc.getFilename() << ":" << ploc.getLine() << "\"";
+
+  //skipped iterations go straight to the next iteration, the loop increment still runs
+  std::string iter = " if (!sstmac_sample_iteration(" + id.str() + "," + detail_ + ","
+      + skip_ + "," + resample_ + "," + tolerance_ + ")) continue;";
+  CompoundStmt* cs = cast<CompoundStmt>(body);
+  CompilerGlobals::rewriter.InsertText(cs->getLBracLoc().getLocWithOffset(1), iter, false);
+
+  //a return or goto out of the loop skips the end call, so every entry resets the sampler
+  //the braces keep the loop a single statement, e.g. as the body of an unbraced if
+  std::string begin = "{ sstmac_sample_loop_begin(" + id.str() + "); ";
+  CompilerGlobals::rewriter.InsertText(getStart(s), begin, false);
+
+  std::string end = " sstmac_sample_loop_end(" + id.str() + "); }";
+  CompilerGlobals::rewriter.InsertText(getEnd(s).getLocWithOffset(1), end, true);
+}
+
 SSTNullVariablePragma::SSTNullVariablePragma(SourceLocation /**loc*/, std::map<std::string, std::list<std::string>>&& args)
  : declAppliedTo_(nullptr),
    transitiveFrom_(nullptr),
@@ -1214,5 +1284,7 @@ static PragmaRegister<SSTArgMapPragmaShim, SSTStackAllocPragma, true> stackAlloc
     "sst", "stack_alloc", ALL_MODES);
 static PragmaRegister<SSTArgMapPragmaShim, SSTBlockingPragma, true> blockingPragma(
     "sst", "blocking", SKELETONIZE | ENCAPSULATE);
+static PragmaRegister<SSTArgMapPragmaShim, SSTSampleLoopPragma, true> sampleLoopPragma(
+    "sst", "sample", SKELETONIZE | SHADOWIZE);
 
 
@@ -690,6 +690,24 @@ class SSTBlockingPragma : public SSTPragma {
   std::string api_;
 };
 
+/**
+ * Marks a timestep loop whose iterations can be fast-forwarded
+ * once their times reach a steady state. The loop body must be in braces.
+ */
+class SSTSampleLoopPragma : public SSTPragma {
+ public:
+  SSTSampleLoopPragma(clang::SourceLocation loc,
+        std::map<std::string, std::list<std::string>>&& args);
+
+  void activate(clang::Stmt *s) override;
+
+ private:
+  std::string detail_;
+  std::string skip_;
+  std::string resample_;
+  std::string tolerance_;
+};
+
 class SSTCallFunctionPragma : public SSTPragma {
  public:
   SSTCallFunctionPragma(clang::SourceLocation loc, const std::list<clang::Token> &tokens);
@@ -0,0 +1,92 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#include <sstmac/hardware/topology/file_image.h>
+#include <sstmac/libraries/nlohmann/json.hpp>
+#include <fstream>
+#include <iostream>
+
+/**
+ * Compile a JSON file topology (and optional routing tables) into a binary
+ * image that topology.filename can point to directly.
+ */
+int
+main(int argc, char **argv)
+{
+  if (argc != 3 && argc != 4){
+    std::cerr << "usage: " << argv[0]
+              << " <topology.json> [routing_tables.json] <output image>" << std::endl;
+    return 1;
+  }
+
+  try {
+    nlohmann::json topology;
+    std::ifstream tin(argv[1]);
+    if (tin.fail()){
+      std::cerr << argv[0] << ": failed to open " << argv[1] << std::endl;
+      return 1;
+    }
+    tin >> topology;
+
+    nlohmann::json routes;
+    if (argc == 4){
+      std::ifstream rin(argv[2]);
+      if (rin.fail()){
+        std::cerr << argv[0] << ": failed to open " << argv[2] << std::endl;
+        return 1;
+      }
+      rin >> routes;
+      routes = routes.at("switches");
+    }
+
+    sstmac::hw::FileTopologyImage::compile(topology,
+      argc == 4 ? &routes : nullptr, argv[argc-1]);
+  } catch (const std::exception &e) {
+    std::cerr << argv[0] << ": failed compiling topology image:\n"
+              << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,288 @@
+"""
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+"""
+
+# Content-addressed cache for the source-to-source step of the SST compiler.
+# The rewritten source and the global variable file produced by sstmac_clang
+# only depend on the preprocessed input, the tool binary, the tool options
+# and the headers force-included after preprocessing. All of these go into
+# the key, so an unchanged translation unit never re-runs the clang tool.
+# A force-included header is hashed together with everything it includes,
+# as listed by the clang the tool is built against.
+# The absolute path of the source is also part of the key because the tool
+# derives the unique name of a refactored main from it.
+
+cacheVersion = "2"
+
+def hashFile(h, path):
+  with open(path, "rb") as f:
+    while True:
+      chunk = f.read(1 << 20)
+      if not chunk:
+        break
+      h.update(chunk)
+
+def toolIdentity(path):
+  import os
+  st = os.stat(path)
+  return "%s:%d:%d" % (os.path.abspath(path), st.st_size, int(st.st_mtime))
+
+def forcedIncludes(cmdArr):
+  incs = []
+  for i in range(len(cmdArr)-1):
+    if cmdArr[i] == "-include":
+      incs.append(cmdArr[i+1])
+  return incs
+
+def includeDeps(compiler, header, flags, typ):
+  """
+  List a header and every file it includes, transitively
+  @return the list of files or None if the compiler could not scan the header
+  """
+  from subprocess import Popen, PIPE
+  lang = "c++" if typ == "c++" else "c"
+  cmdArr = [compiler, "-x", lang]
+  cmdArr.extend(flags)
+  cmdArr.extend(["-M", header])
+  child = Popen(cmdArr, stdout=PIPE)
+  out, err = child.communicate()
+  if child.returncode != 0:
+    return None
+  #the make rule is "target: dep dep ..." with lines continued by a backslash
+  text = out.decode("utf-8").replace("\\\n", " ")
+  return text.split(":", 1)[1].split()
+
+class DepScanner:
+  """
+  Runs includeDeps once per header with the flags of the clang tool
+  """
+  def __init__(self, compiler, flags, typ):
+    self.compiler = compiler
+    self.flags = flags
+    self.typ = typ
+    self.scanned = {}
+
+  def __call__(self, header):
+    if not header in self.scanned:
+      self.scanned[header] = includeDeps(self.compiler, header, self.flags, self.typ)
+    return self.scanned[header]
+
+def hashDeps(h, deps):
+  import os
+  for dep in deps:
+    h.update(b"\0")
+    h.update(os.path.abspath(dep).encode("utf-8"))
+    hashFile(h, dep)
+
+class Src2SrcCache:
+  def __init__(self, cacheDir):
+    import os
+    self.cacheDir = os.path.abspath(os.path.expanduser(cacheDir))
+
+  def key(self, sourceFile, ppFile, cmdArr, depScan):
+    """
+    @return the key or None if the dependencies of a forced include are unknown
+    """
+    import hashlib
+    import os
+    h = hashlib.sha256()
+    h.update(cacheVersion.encode("utf-8"))
+    h.update(toolIdentity(cmdArr[0]).encode("utf-8"))
+    h.update(os.path.abspath(sourceFile).encode("utf-8"))
+    for arg in cmdArr[1:]:
+      if arg == ppFile:
+        continue #the temp file name is not part of the content
+      h.update(b"\0")
+      h.update(arg.encode("utf-8"))
+    for inc in forcedIncludes(cmdArr):
+      deps = depScan(inc)
+      if deps is None:
+        return None
+      hashDeps(h, deps)
+    hashFile(h, ppFile)
+    return h.hexdigest()
+
+  def entryDir(self, key):
+    import os
+    return os.path.join(self.cacheDir, key[:2], key)
+
+  def fetch(self, key, outputs, verbose):
+    import os
+    import shutil
+    import sys
+    entry = self.entryDir(key)
+    if not os.path.isdir(entry):
+      return False
+    for idx, out in enumerate(outputs):
+      cached = os.path.join(entry, str(idx))
+      if not os.path.isfile(cached):
+        return False
+    for idx, out in enumerate(outputs):
+      shutil.copyfile(os.path.join(entry, str(idx)), out)
+    if verbose:
+      sys.stderr.write("src2src cache hit %s\n" % key)
+    return True
+
+  def store(self, key, outputs):
+    import os
+    import shutil
+    import tempfile
+    entry = self.entryDir(key)
+    if os.path.isdir(entry):
+      return
+    parent = os.path.dirname(entry)
+    if not os.path.isdir(parent):
+      try:
+        os.makedirs(parent)
+      except OSError:
+        pass #another compile made it first
+    #build the entry in a temp dir and rename it so concurrent builds never see partial entries
+    tmpDir = tempfile.mkdtemp(dir=parent)
+    for idx, out in enumerate(outputs):
+      shutil.copyfile(out, os.path.join(tmpDir, str(idx)))
+    try:
+      os.rename(tmpDir, entry)
+    except OSError:
+      shutil.rmtree(tmpDir, ignore_errors=True)
+
+class CachedSrc2Src:
+  """
+  A build step for runAllCmds that runs the clang tool only on a cache miss.
+  The key is always built from cmdArr, which force-includes headers as source.
+  If a PCH is given, a miss runs the tool with the PCH in place of the header
+  and falls back to cmdArr if the tool cannot load it.
+  """
+  def __init__(self, cache, sourceFile, ppFile, cmdArr, outputs, depScan, pch=None):
+    self.cache = cache
+    self.sourceFile = sourceFile
+    self.ppFile = ppFile
+    self.cmdArr = cmdArr
+    self.outputs = outputs
+    self.depScan = depScan
+    self.pch = pch
+
+  def __str__(self):
+    return "[src2src cache %s] %s" % (self.cache.cacheDir, " ".join(self.cmdArr))
+
+  def run(self, cmdArr):
+    from subprocess import Popen
+    child = Popen([x.strip() for x in cmdArr])
+    child.communicate()
+    return child.returncode
+
+  def pchCmdArr(self):
+    cmdArr = list(self.cmdArr)
+    header, pch = self.pch
+    idx = cmdArr.index(header)
+    cmdArr[idx-1] = "-include-pch"
+    cmdArr[idx] = pch
+    return cmdArr
+
+  def __call__(self, verbose):
+    import sys
+    key = self.cache.key(self.sourceFile, self.ppFile, self.cmdArr, self.depScan)
+    if key is None:
+      if verbose:
+        sys.stderr.write("src2src cache skipped, could not list the included headers\n")
+      return self.run(self.cmdArr)
+    if self.cache.fetch(key, self.outputs, verbose):
+      return 0
+    if verbose:
+      sys.stderr.write("src2src cache miss %s\n" % key)
+    rc = 1
+    if self.pch:
+      rc = self.run(self.pchCmdArr())
+      if rc != 0:
+        sys.stderr.write("src2src tool rejected %s, retrying without it\n" % self.pch[1])
+    if rc != 0:
+      rc = self.run(self.cmdArr)
+    if rc == 0:
+      self.cache.store(key, self.outputs)
+    return rc
+
+def precompileHeader(cache, tool, compiler, header, flags, typ, depScan, verbose):
+  """
+  Build (or reuse) a precompiled header for a header force-included into
+  every source-to-source run, e.g. fixIntrinsics.h. The compiler must be
+  the clang the tool is built against, otherwise the tool rejects the PCH.
+  @return the path of the PCH file or None if it could not be built
+  """
+  import hashlib
+  import os
+  import sys
+  from subprocess import Popen
+  deps = depScan(header)
+  if deps is None:
+    return None
+  h = hashlib.sha256()
+  h.update(cacheVersion.encode("utf-8"))
+  h.update(toolIdentity(tool).encode("utf-8"))
+  h.update(toolIdentity(compiler).encode("utf-8"))
+  for f in flags:
+    h.update(b"\0")
+    h.update(f.encode("utf-8"))
+  hashDeps(h, deps)
+  key = h.hexdigest()
+  entry = cache.entryDir(key)
+  pch = os.path.join(entry, os.path.basename(header) + ".pch")
+  if os.path.isfile(pch):
+    return pch
+
+  if not os.path.isdir(entry):
+    try:
+      os.makedirs(entry)
+    except OSError:
+      pass
+  lang = "c++-header" if typ == "c++" else "c-header"
+  tmpPch = "%s.%d" % (pch, os.getpid())
+  cmdArr = [compiler, "-x", lang]
+  cmdArr.extend(flags)
+  cmdArr.extend([header, "-o", tmpPch])
+  if verbose:
+    sys.stderr.write("%s\n" % " ".join(cmdArr))
+  child = Popen(cmdArr)
+  child.communicate()
+  if child.returncode != 0:
+    return None
+  os.rename(tmpPch, pch)
+  return pch
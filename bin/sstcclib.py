@@ -47,6 +47,8 @@ SSTMAC_VERBOSE=0 or 1:        produce verbose output from the SST compiler (defa
 SSTMAC_DELETE_TEMPS=0 or 1:   remove all temp source-to-source files (default 1)
 SSTMAC_DELETE_TEMP_OFILES=0 or 1:   remove all temporary object files (default 1)
 SSTMAC_CONFIG=0: running automake, cmake - skip certain steps to fool build system
+SSTMAC_SRC2SRC_CACHE=<dir>:   reuse source-to-source output for unchanged preprocessed files
+SSTMAC_SRC2SRC_PCH=0 or 1:    precompile fixIntrinsics.h into the cache dir (default 0)
 """
 
 def createBashWrapper(compiler, exeName, ldTarget, sstCore, sstmacExe):
@@ -161,16 +163,19 @@ def runAllCmds(cmds, verbose, doDeleteSources, doDeleteObjects, clangBin):
   for outfile, cmdArr, tempFiles in cmds:
     if verbose:
       sys.stderr.write("===============================\n")
-      sys.stderr.write(" ".join(cmdArr))
+      sys.stderr.write(str(cmdArr) if callable(cmdArr) else " ".join(cmdArr))
       sys.stderr.write("\n")
-    stdout=None
-    if outfile:
-      stdout = open(outfile,"w")
-    child = Popen([x.strip() for x in cmdArr],stdout=stdout)
-    result = child.communicate()
-    if outfile:
-      stdout.close()
-    rc = child.returncode
+    if callable(cmdArr): #a build step that decides itself what to run, e.g. cached src2src
+      rc = cmdArr(verbose)
+    else:
+      stdout=None
+      if outfile:
+        stdout = open(outfile,"w")
+      child = Popen([x.strip() for x in cmdArr],stdout=stdout)
+      result = child.communicate()
+      if outfile:
+        stdout.close()
+      rc = child.returncode
     if not rc == 0:
       return rc
 
@@ -205,6 +210,9 @@ class Context:
     self.sstCore = False
     self.hasClang = False
     self.src2srcDebug = False
+    self.src2srcCache = None
+    self.src2srcPch = False
+    self.verbose = False
 
   def simulateMode(self):
     return self.mode == self.SKELETONIZE
@@ -310,6 +318,7 @@ def run(typ, extraLibs=""):
   args, extraArgs = parser.parse_known_args()
 
   ctx = Context()
+  ctx.verbose = verbose
 
   ctx.sstCore = sstCore
   ctx.cc = spackcc if spackcc else cc
@@ -390,6 +399,11 @@ def run(typ, extraLibs=""):
   if "SSTMAC_DEBUG_SRC2SRC" in os.environ:
     ctx.src2srcDebug = int(os.environ["SSTMAC_DEBUG_SRC2SRC"])
 
+  if os.environ.get("SSTMAC_SRC2SRC_CACHE"):
+    ctx.src2srcCache = os.environ["SSTMAC_SRC2SRC_CACHE"]
+    if "SSTMAC_SRC2SRC_PCH" in os.environ:
+      ctx.src2srcPch = bool(int(os.environ["SSTMAC_SRC2SRC_PCH"]))
+
   if args.sst_component:
     ctx.setMode(ctx.COMPONENT)
 
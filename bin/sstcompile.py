@@ -122,6 +122,7 @@ def addSrc2SrcCompile(ctx, sourceFile, outputFile, args, cmds):
   from sstccvars import clangLibtoolingCxxFlagsStr, clangLibtoolingCFlagsStr
   from sstccvars import haveFloat128
   from sstccvars import sstStdFlag
+  from sstccvars import clangDir
   import os
 
   #First we must pre-process the file to get it read for source-to-source
@@ -163,7 +164,28 @@ def addSrc2SrcCompile(ctx, sourceFile, outputFile, args, cmds):
   srcRepl = addPrefixAndRebase("sst.pp.",sourceFile,objBaseFolder)
   cxxInitSrcFile = addPrefixAndRebase("sstGlobals.pp.",sourceFile,objBaseFolder) + ".cpp"
   if not ctx.src2srcDebug:
-    cmds.append([None,clangCmdArr,[ppTmpFile,srcRepl,cxxInitSrcFile]]) #None -> don't pipe output anywhere
+    if ctx.src2srcCache:
+      from sstcccache import Src2SrcCache, CachedSrc2Src, DepScanner, precompileHeader
+      cache = Src2SrcCache(ctx.src2srcCache)
+      #the tool is linked against the clang in clangDir, so that clang scans
+      #the forced includes and builds the PCH with the tool options
+      sepIdx = clangCmdArr.index("--")
+      incIdx = clangCmdArr.index("-include", sepIdx)
+      toolFlags = clangCmdArr[sepIdx+1:incIdx] + clangCmdArr[incIdx+2:]
+      compiler = os.path.join(clangDir, "bin", "clang++" if ctx.typ == "c++" else "clang")
+      depScan = DepScanner(compiler, toolFlags, ctx.typ)
+      pch = None
+      if ctx.src2srcPch:
+        #parse fixIntrinsics.h once per flag set instead of once per file
+        pchFile = precompileHeader(cache, clangDeglobal, compiler, intrinsicsFixerPath,
+                                   toolFlags, ctx.typ, depScan, ctx.verbose)
+        if pchFile:
+          pch = (intrinsicsFixerPath, pchFile)
+      step = CachedSrc2Src(cache, sourceFile, ppTmpFile, clangCmdArr, [srcRepl,cxxInitSrcFile],
+                           depScan, pch)
+      cmds.append([None,step,[ppTmpFile,srcRepl,cxxInitSrcFile]])
+    else:
+      cmds.append([None,clangCmdArr,[ppTmpFile,srcRepl,cxxInitSrcFile]]) #None -> don't pipe output anywhere
 
   tmpTarget = addPrefix("tmp.", outputFile)
   llvmPasses = []
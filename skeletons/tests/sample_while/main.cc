@@ -41,43 +41,27 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 Questions? Contact sst-macro-help@sandia.gov
 */
-#ifndef sstmac_common_handler_queue_entry_H
-#define sstmac_common_handler_queue_entry_H
 
-#include <sstmac/common/sst_event.h>
-#include <sstmac/common/event_handler.h>
-#include <sprockit/thread_safe_new.h>
+#include <mpi.h>
+#include <stdio.h>
+#include <sstmac/compute.h>
 
-namespace sstmac {
-
-class HandlerExecutionEvent :
-  public ExecutionEvent,
-  public sprockit::thread_safe_new<HandlerExecutionEvent>
+/**
+ * A timestep loop that advances its condition in the body. Skipping the
+ * body would never advance the step, so the skeletonizer must refuse it.
+ */
+int main(int argc, char** argv)
 {
- public:
-#if SSTMAC_CUSTOM_NEW
-  using sprockit::thread_safe_new<HandlerExecutionEvent>::operator delete;
-#endif
-
-  ~HandlerExecutionEvent() override {}
-
-  HandlerExecutionEvent(Event* ev, EventHandler* hand) :
-    ev_to_deliver_(ev),
-    handler_(hand)
-  {
-  }
-
-  void execute() override {
-    handler_->handle(ev_to_deliver_);
+  MPI_Init(&argc, &argv);
+  double local = 1;
+  double global = 0;
+  int step = 0;
+#pragma sst sample detail(4) skip(20) resample(2)
+  while (step < 200){
+    sstmac_compute(1e-5);
+    MPI_Allreduce(&local, &global, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    ++step;
   }
-
- protected:
-  Event* ev_to_deliver_;
-
-  EventHandler* handler_;
-
-};
-
+  MPI_Finalize();
+  return 0;
 }
-
-#endif
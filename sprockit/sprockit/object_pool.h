@@ -0,0 +1,265 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#ifndef SPROCKIT_OBJECT_POOL_H
+#define SPROCKIT_OBJECT_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <typeinfo>
+#include <vector>
+#include <algorithm>
+#include <cxxabi.h>
+#include <cstdlib>
+#include <string>
+
+namespace sprockit {
+
+/**
+ * Counters for a single pooled type. Visible through ObjectPoolRegistry
+ * so that the live object count of every pool can be reported.
+ */
+struct ObjectPoolStats {
+  std::string name;
+  const std::atomic<int64_t>* live;
+  uint64_t capacity;
+};
+
+class ObjectPoolRegistry {
+ public:
+  template <class Fxn>
+  static void forEach(Fxn&& fxn){
+    std::lock_guard<std::mutex> guard(lock());
+    for (ObjectPoolStats* stats : pools()){
+      fxn(*stats);
+    }
+  }
+
+  static void add(ObjectPoolStats* stats){
+    std::lock_guard<std::mutex> guard(lock());
+    pools().push_back(stats);
+  }
+
+  static void remove(ObjectPoolStats* stats){
+    std::lock_guard<std::mutex> guard(lock());
+    auto& vec = pools();
+    vec.erase(std::remove(vec.begin(), vec.end(), stats), vec.end());
+  }
+
+ private:
+  static std::vector<ObjectPoolStats*>& pools(){
+    static std::vector<ObjectPoolStats*> pools;
+    return pools;
+  }
+
+  static std::mutex& lock(){
+    static std::mutex lock;
+    return lock;
+  }
+};
+
+/**
+ * Typed, thread-aware memory pool for small, frequently allocated objects
+ * like packets and credits.  Classes inherit from ObjectPool<Self> to pick
+ * up the class-specific operator new/delete.
+ *
+ * Each OS thread keeps an intrusive free list, so the common alloc/free path
+ * takes no locks. Objects are frequently allocated on one component/thread and
+ * freed on another. When a thread accumulates too many free objects, a batch
+ * is handed back to a shared depot that other threads refill from, which keeps
+ * producer/consumer thread pairs from growing the pool without bound.
+ */
+template <class T>
+class ObjectPool {
+ public:
+  static void* operator new(size_t sz){
+    if (sz != sizeof(T)){
+      //derived type that did not declare its own pool
+      return ::operator new(sz);
+    }
+    ThreadCache& cache = cache_;
+    if (!cache.head){
+      refill(cache);
+    }
+    FreeNode* node = cache.head;
+    cache.head = node->next;
+    --cache.size;
+    live_.fetch_add(1, std::memory_order_relaxed);
+    return node;
+  }
+
+  static void* operator new(size_t  /*sz*/, void* ptr){
+    return ptr;
+  }
+
+  static void operator delete(void* ptr, size_t sz){
+    if (!ptr) return;
+
+    if (sz != sizeof(T)){
+      ::operator delete(ptr);
+      return;
+    }
+    ThreadCache& cache = cache_;
+    FreeNode* node = static_cast<FreeNode*>(ptr);
+    node->next = cache.head;
+    cache.head = node;
+    ++cache.size;
+    live_.fetch_sub(1, std::memory_order_relaxed);
+    if (cache.size >= 2*batch_size){
+      release(cache);
+    }
+  }
+
+  /**
+   * @return The number of objects of this type currently allocated from the pool (all threads)
+   */
+  static int64_t numLive() {
+    return live_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct FreeNode {
+    FreeNode* next;
+  };
+
+  struct ThreadCache {
+    FreeNode* head;
+    uint32_t size;
+  };
+
+  struct Batch {
+    FreeNode* head;
+    uint32_t size;
+  };
+
+  struct Depot {
+    std::mutex lock;
+    std::vector<Batch> batches;
+    std::vector<char*> chunks;
+    ObjectPoolStats stats;
+
+    Depot(){
+      int status = 0;
+      char* name = abi::__cxa_demangle(typeid(T).name(), nullptr, nullptr, &status);
+      stats.name = status == 0 ? name : typeid(T).name();
+      ::free(name);
+      stats.live = &live_;
+      stats.capacity = 0;
+      ObjectPoolRegistry::add(&stats);
+    }
+
+    ~Depot(){
+      ObjectPoolRegistry::remove(&stats);
+      for (char* chunk : chunks){
+        delete[] chunk;
+      }
+    }
+  };
+
+  static constexpr uint32_t batch_size = 512;
+
+  static constexpr size_t min_size = sizeof(T) > sizeof(FreeNode) ? sizeof(T) : sizeof(FreeNode);
+
+  static constexpr size_t unit_size =
+    ((min_size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t)) * alignof(std::max_align_t);
+
+  static Depot& depot(){
+    static Depot d;
+    return d;
+  }
+
+  static void refill(ThreadCache& cache){
+    Depot& d = depot();
+    std::lock_guard<std::mutex> guard(d.lock);
+    if (!d.batches.empty()){
+      Batch b = d.batches.back();
+      d.batches.pop_back();
+      cache.head = b.head;
+      cache.size = b.size;
+      return;
+    }
+
+    char* chunk = new char[unit_size*batch_size];
+    d.chunks.push_back(chunk);
+    d.stats.capacity += batch_size;
+    FreeNode* head = nullptr;
+    for (uint32_t i=batch_size; i > 0; --i){
+      FreeNode* node = reinterpret_cast<FreeNode*>(chunk + (i-1)*unit_size);
+      node->next = head;
+      head = node;
+    }
+    cache.head = head;
+    cache.size = batch_size;
+  }
+
+  static void release(ThreadCache& cache){
+    Batch b;
+    b.head = cache.head;
+    b.size = batch_size;
+    FreeNode* tail = cache.head;
+    for (uint32_t i=1; i < batch_size; ++i){
+      tail = tail->next;
+    }
+    cache.head = tail->next;
+    cache.size -= batch_size;
+    tail->next = nullptr;
+
+    Depot& d = depot();
+    std::lock_guard<std::mutex> guard(d.lock);
+    d.batches.push_back(b);
+  }
+
+  static thread_local ThreadCache cache_;
+  static std::atomic<int64_t> live_;
+};
+
+template <class T> thread_local typename ObjectPool<T>::ThreadCache ObjectPool<T>::cache_;
+template <class T> std::atomic<int64_t> ObjectPool<T>::live_(0);
+
+}
+
+#endif // SPROCKIT_OBJECT_POOL_H
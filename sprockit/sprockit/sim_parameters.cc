@@ -146,71 +146,166 @@ get_bandwidth_from_str(const char* val, const char* key)
   return ret;
 }
 
+long
+get_long_from_str(const char* val, const char* key)
+{
+  char* end = const_cast<char*>(val);
+  long ret = ::strtol(val, &end, 0);
+  if (val == end) {
+    spkt_abort_printf("sim_parameters: param %s with value %s is not formatted as an integer",
+                     key, val);
+  }
+  return ret;
+}
+
+double
+get_double_from_str(const char* val, const char* key)
+{
+  char* end = const_cast<char*>(val);
+  double ret = ::strtod(val, &end);
+  if (val == end) {
+    spkt_abort_printf("sim_parameters: param %s with value %s is not formatted as a double",
+                     key, val);
+  }
+  return ret;
+}
+
+bool
+get_bool_from_str(const char* val, const char* key)
+{
+  if (::strcmp(val, "true") == 0 || ::strcmp(val, "1") == 0) {
+    return true;
+  } else if (::strcmp(val, "false") != 0 && ::strcmp(val, "0") != 0) {
+    spkt_abort_printf("sim_parameters: param %s with value %s is not formatted as a proper boolean",
+                     key, val);
+  }
+  return false;
+}
+
+static std::atomic<uint64_t> num_param_lookups(0);
+static std::atomic<uint64_t> num_param_misses(0);
+static std::atomic<uint64_t> num_param_parses(0);
+static std::atomic<uint64_t> num_param_cache_hits(0);
+
+ParamStats
+SimParameters::stats()
+{
+  ParamStats ret;
+  ret.lookups = num_param_lookups.load(std::memory_order_relaxed);
+  ret.misses = num_param_misses.load(std::memory_order_relaxed);
+  ret.parses = num_param_parses.load(std::memory_order_relaxed);
+  ret.cacheHits = num_param_cache_hits.load(std::memory_order_relaxed);
+  return ret;
+}
+
+SimParameters::parameter_entry*
+SimParameters::findEntry(const std::string& key)
+{
+  num_param_lookups.fetch_add(1, std::memory_order_relaxed);
+  auto it = params_.find(key);
+  if (it == params_.end()){
+    num_param_misses.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  parameter_entry& entry = it->second;
+  entry.read = true;
+  return &entry;
+}
+
+SimParameters::parameter_entry&
+SimParameters::getEntry(const std::string& key)
+{
+  debug_printf(dbg::params | dbg::read_params,
+    "sim_parameters: getting key %s\n",
+    key.c_str());
+
+  parameter_entry* entry = findEntry(key);
+  if (!entry){
+    throwKeyError(key);
+  }
+  return *entry;
+}
+
+template <class T, class Parse>
+T
+SimParameters::parseCached(parameter_entry& entry, ParamEntry::parse_t ty, Parse&& parse)
+{
+  T ret;
+  if (entry.cached(ty, ret)){
+    num_param_cache_hits.fetch_add(1, std::memory_order_relaxed);
+    return ret;
+  }
+  num_param_parses.fetch_add(1, std::memory_order_relaxed);
+  ret = parse(entry.value.c_str());
+  entry.cache(ty, ret);
+  return ret;
+}
+
 ParamAssign::operator int() const
 {
-  return getQuantityWithUnits(param_.c_str(), key_.c_str());
+  return getQuantityWithUnits(entry_.value.c_str(), key_.c_str());
 }
 
 ParamAssign::operator double() const
 {
-  return getQuantityWithUnits(param_.c_str(), key_.c_str());
+  return getQuantityWithUnits(entry_.value.c_str(), key_.c_str());
 }
 
 void
 ParamAssign::operator=(int x)
 {
-  param_ = sprockit::sprintf("%d", x); 
+  entry_.assign(sprockit::sprintf("%d", x));
 }
 
 void
 ParamAssign::operator=(double x)
 {
-  param_ = sprockit::sprintf("%f", x); 
+  entry_.assign(sprockit::sprintf("%f", x));
 }
 
 double
 ParamAssign::getBandwidth() const
 {
-  return get_bandwidth_from_str(param_.c_str(), key_.c_str()); 
+  return get_bandwidth_from_str(entry_.value.c_str(), key_.c_str()); 
 }
 
 double
 ParamAssign::getFrequency() const
 {
-  return get_freq_from_str(param_.c_str(), key_.c_str()); 
+  return get_freq_from_str(entry_.value.c_str(), key_.c_str()); 
 }
 
 long
 ParamAssign::getByteLength() const
 {
-  return get_byte_length_from_str(param_.c_str(), key_.c_str());
+  return get_byte_length_from_str(entry_.value.c_str(), key_.c_str());
 }
 
 double
 ParamAssign::getTime() const
 {
-  return get_time_from_str(param_.c_str(), key_.c_str());
+  return get_time_from_str(entry_.value.c_str(), key_.c_str());
 }
 
 const std::string&
 ParamAssign::set(const char* str)
 {
-  param_ = str;
-  return param_;
+  entry_.assign(str);
+  return entry_.value;
 }
 
 const std::string&
 ParamAssign::set(const std::string& str)
 {
-  param_ = str;
-  return param_;
+  entry_.assign(str);
+  return entry_.value;
 }
 
 const std::string&
 ParamAssign::setValue(double x, const char* units)
 {
-  param_ = sprockit::sprintf("%f%s", x, units);
-  return param_;
+  entry_.assign(sprockit::sprintf("%f%s", x, units));
+  return entry_.value;
 }
 
 const std::string&
@@ -234,8 +329,8 @@ ParamAssign::setFrequency(double x, const char* units)
 const std::string&
 ParamAssign::setByteLength(long x, const char* units)
 {
-  param_ = sprockit::sprintf("%ld%s", x, units);
-  return param_;
+  entry_.assign(sprockit::sprintf("%ld%s", x, units));
+  return entry_.value;
 }
 
 SimParameters::SimParameters() :
@@ -367,20 +462,8 @@ SimParameters::addParamOverrideRecursive(const std::string &key, const std::stri
 std::string
 SimParameters::getOptionalParam(const std::string &key, const std::string &def)
 {
-  if (hasParam(key)){
-    return getParam(key);
-  } else {
-    return def;
-  }
-  /**
-  if (has_param(key)) {
-    return get_param(key);
-  } else if (parent_){
-    return parent_->get_optional_param(key,def);
-  } else {
-   return def;
-  }
-  */
+  parameter_entry* entry = findEntry(key);
+  return entry ? entry->value : def;
 }
 
 SimParameters::ptr
@@ -435,128 +518,103 @@ SimParameters::getOptionalNamespace(const std::string& ns)
 long
 SimParameters::getLongParam(const std::string &key)
 {
-  std::string v = getParam(key);
-  const char* begin = v.c_str();
-  char* end = const_cast<char*>(begin);
-  long ret = ::strtol(begin, &end, 0);
-  if (begin == end) {
-    spkt_abort_printf("sim_parameters::get_long_param: param %s with value %s is not formatted as an integer",
-                     key.c_str(), v.c_str());
-  }
-  return ret;
+  return parseCached<long>(getEntry(key), ParamEntry::integer,
+    [&](const char* v){ return get_long_from_str(v, key.c_str()); });
 }
 
 long
 SimParameters::getOptionalLongParam(const std::string &key, long def)
 {
-  if (hasParam(key)) {
-    return getLongParam(key);
-  }
-  return def;
+  parameter_entry* entry = findEntry(key);
+  if (!entry) return def;
+  return parseCached<long>(*entry, ParamEntry::integer,
+    [&](const char* v){ return get_long_from_str(v, key.c_str()); });
 }
 
-
 double
 SimParameters::getTimeParam(const std::string& key)
 {
-  return get_time_from_str(getParam(key).c_str(), key.c_str());
-
+  return parseCached<double>(getEntry(key), ParamEntry::time,
+    [&](const char* v){ return get_time_from_str(v, key.c_str()); });
 }
 
 double
 SimParameters::getOptionalTimeParam(const std::string &key,
                                         double def)
 {
-  if (hasParam(key)) {
-    return getTimeParam(key);
-  }
-  return def;
+  parameter_entry* entry = findEntry(key);
+  if (!entry) return def;
+  return parseCached<double>(*entry, ParamEntry::time,
+    [&](const char* v){ return get_time_from_str(v, key.c_str()); });
 }
 
 double
 SimParameters::getQuantity(const std::string& key)
 {
-  std::string value = getParam(key);
-  return getQuantityWithUnits(value.c_str(), key.c_str());
+  return parseCached<double>(getEntry(key), ParamEntry::quantity,
+    [&](const char* v){ return getQuantityWithUnits(v, key.c_str()); });
+}
+
+bool
+SimParameters::tryGetQuantity(const std::string &key, double& ret)
+{
+  parameter_entry* entry = findEntry(key);
+  if (!entry) return false;
+  ret = parseCached<double>(*entry, ParamEntry::quantity,
+    [&](const char* v){ return getQuantityWithUnits(v, key.c_str()); });
+  return true;
 }
 
 double
 SimParameters::getOptionalQuantity(const std::string &key, double def)
 {
-  if (hasParam(key)){
-    return getQuantity(key);
-  } else {
-    return def;
-  }
+  double ret = def;
+  tryGetQuantity(key, ret);
+  return ret;
 }
 
 double
 SimParameters::getDoubleParam(const std::string& key)
 {
-  std::string v = getParam(key);
-  const char* begin = v.c_str();
-  char* end = const_cast<char*>(begin);
-  double ret = ::strtod(begin, &end);
-  if (begin == end) {
-    spkt_abort_printf("sim_parameters::get_double_param: param %s with value %s is not formatted as a double",
-                     key.c_str(), v.c_str());
-  }
-  return ret;
+  return parseCached<double>(getEntry(key), ParamEntry::real,
+    [&](const char* v){ return get_double_from_str(v, key.c_str()); });
 }
 
 double
 SimParameters::getOptionalDoubleParam(const std::string &key, double def)
 {
-  if (hasParam(key)) {
-    return getDoubleParam(key);
-  }
-
-  return def;
+  parameter_entry* entry = findEntry(key);
+  if (!entry) return def;
+  return parseCached<double>(*entry, ParamEntry::real,
+    [&](const char* v){ return get_double_from_str(v, key.c_str()); });
 }
 
 int
 SimParameters::getOptionalIntParam(const std::string &key, int def)
 {
-  if (hasParam(key)) {
-    return getIntParam(key);
-  }
-  return def;
+  return getOptionalLongParam(key, def);
 }
 
 int
 SimParameters::getIntParam(const std::string& key)
 {
-  std::string v = getParam(key);
-  const char* begin = v.c_str();
-  char* end = const_cast<char*>(begin);
-  long ret = ::strtol(begin, &end, 0);
-  if (begin == end) {
-    spkt_abort_printf("sim_parameters::get_int_param: param %s with value %s is not formatted as an integer",
-                     key.c_str(), v.c_str());
-  }
-  return ret;
+  return getLongParam(key);
 }
 
 bool
 SimParameters::getOptionalBoolParam(const std::string &key, bool def)
 {
-  if (hasParam(key)) {
-    return getBoolParam(key);
-  }
-  return def;
+  parameter_entry* entry = findEntry(key);
+  if (!entry) return def;
+  return parseCached<bool>(*entry, ParamEntry::boolean,
+    [&](const char* v){ return get_bool_from_str(v, key.c_str()); });
 }
 
 bool
 SimParameters::getBoolParam(const std::string &key)
 {
-  std::string v = getParam(key);
-  if (v == "true" || v == "1") {
-    return true;
-  } else if (v != "false" && v != "0") {
-    spkt_abort_printf("sim_parameters::get_bool_param: param %s with value %s is not formatted as a proper boolean",
-                     key.c_str(), v.c_str());
-  }
-  return false;
+  return parseCached<bool>(getEntry(key), ParamEntry::boolean,
+    [&](const char* v){ return get_bool_from_str(v, key.c_str()); });
 }
 
 std::deque<std::string>
@@ -579,58 +637,58 @@ SimParameters::getTokenizer(const std::string& key)
 double
 SimParameters::getFreqParam(const std::string &key)
 {
-  std::string param_value_str = getParam(key);
-  return get_freq_from_str(param_value_str.c_str(), key.c_str());
+  return parseCached<double>(getEntry(key), ParamEntry::frequency,
+    [&](const char* v){ return get_freq_from_str(v, key.c_str()); });
 }
 
 double
 SimParameters::getOptionalFreqParam(const std::string &key, double def)
 {
-  std::string freq_str = sprockit::sprintf("%eHz", def);
-  std::string param_value_str = getOptionalParam(key, freq_str);
-  return get_freq_from_str(param_value_str.c_str(), key.c_str());
+  parameter_entry* entry = findEntry(key);
+  if (!entry) return def;
+  return parseCached<double>(*entry, ParamEntry::frequency,
+    [&](const char* v){ return get_freq_from_str(v, key.c_str()); });
 }
 
 long
 SimParameters::getByteLengthParam(const std::string &key)
 {
-  std::string param_value_str = getParam(key);
-  return get_byte_length_from_str(param_value_str.c_str(), key.c_str());
+  return parseCached<long>(getEntry(key), ParamEntry::byte_length,
+    [&](const char* v){ return get_byte_length_from_str(v, key.c_str()); });
 }
 
 long
 SimParameters::getOptionalByteLengthParam(const std::string& key, long length)
 {
-  std::string length_str = sprockit::sprintf("%ldB", length);
-  std::string param_value_str = getOptionalParam(key, length_str);
-  return get_byte_length_from_str(param_value_str.c_str(), key.c_str());
+  parameter_entry* entry = findEntry(key);
+  if (!entry) return length;
+  return parseCached<long>(*entry, ParamEntry::byte_length,
+    [&](const char* v){ return get_byte_length_from_str(v, key.c_str()); });
 }
 
 double
 SimParameters::getBandwidthParam(const std::string &key)
 {
-  std::string param_value_str = getParam(key);
-  return get_bandwidth_from_str(param_value_str.c_str(), key.c_str());
+  return parseCached<double>(getEntry(key), ParamEntry::bandwidth,
+    [&](const char* v){ return get_bandwidth_from_str(v, key.c_str()); });
 }
 
 double
 SimParameters::getOptionalBandwidthParam(const std::string &key, const std::string& def)
 {
-  bool errorflag = false;
-  std::string param_value_str = getOptionalParam(key, def);
-  double val = getBandwidth(param_value_str.c_str(), errorflag);
-  if (errorflag) {
-    spkt_abort_printf("improperly formatted bandwidth (%s) for parameter %s",
-                     param_value_str.c_str(), key.c_str());
-  }
-  return val;
+  parameter_entry* entry = findEntry(key);
+  if (!entry) return get_bandwidth_from_str(def.c_str(), key.c_str());
+  return parseCached<double>(*entry, ParamEntry::bandwidth,
+    [&](const char* v){ return get_bandwidth_from_str(v, key.c_str()); });
 }
 
 double
 SimParameters::getOptionalBandwidthParam(const std::string &key, double def)
 {
-  std::string bwstr = sprockit::sprintf("%ebytes/sec", def);
-  return getOptionalBandwidthParam(key, bwstr);
+  parameter_entry* entry = findEntry(key);
+  if (!entry) return def;
+  return parseCached<double>(*entry, ParamEntry::bandwidth,
+    [&](const char* v){ return get_bandwidth_from_str(v, key.c_str()); });
 }
 
 void
@@ -885,13 +943,11 @@ bool
 SimParameters::getScopedParam(std::string& inout,
                           const std::string& key)
 {
-  auto it = params_.find(key);
-  if (it == params_.end()){
+  parameter_entry* entry = findEntry(key);
+  if (!entry){
     return false;
   }
-  parameter_entry& entry = it->second;
-  entry.read = true;
-  inout = entry.value;
+  inout = entry->value;
   return true;
 }
 
@@ -1000,7 +1056,7 @@ SimParameters::doAddParam(
       spkt_abort_printf("sim_parameters::add_param - key already in params: %s", key.c_str());
     } else if (override_existing){
       parameter_entry& entry = it->second;
-      entry.value = val;
+      entry.assign(val);
       entry.read = mark_as_read;
     } else {
       //do nothing - don't override and don't fail
@@ -1018,7 +1074,7 @@ SimParameters::operator[](const std::string& key)
 {
   std::string final_key;
   SimParameters* scope = getScopeAndKey(key, final_key);
-  return ParamAssign(scope->params_[final_key].value, key);
+  return ParamAssign(scope->params_[final_key], key);
 }
 
 void
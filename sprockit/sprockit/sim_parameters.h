@@ -49,6 +49,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <sprockit/sim_parameters_fwd.h>
 #include <unordered_map>
+#include <atomic>
 
 #include <sstream>
 #include <iostream>
@@ -78,17 +79,104 @@ namespace sprockit {
 bool getQuantityWithUnits(const char *value, double& ret);
 double getQuantityWithUnits(const char *value, const char* key);
 
+/**
+ * A single parameter value. Typed lookups parse the string once and keep
+ * the result so that every component scoped into a shared namespace
+ * reuses it. The cache is per parse type and filled lock-free since
+ * application params can be read from several event threads at once.
+ */
+struct ParamEntry
+{
+  enum parse_t {
+    integer=0,
+    real,
+    boolean,
+    quantity,
+    time,
+    bandwidth,
+    frequency,
+    byte_length,
+    num_parse_types
+  };
+
+  ParamEntry() : read(false), claimed_(0), valid_(0) {}
+
+  ParamEntry(const ParamEntry& other) :
+    value(other.value), read(other.read), claimed_(0), valid_(0)
+  {
+  }
+
+  ParamEntry& operator=(const ParamEntry& other){
+    assign(other.value);
+    read = other.read;
+    return *this;
+  }
+
+  /** Set a new string value and drop all parsed forms of the old one */
+  void assign(const std::string& v){
+    value = v;
+    claimed_.store(0, std::memory_order_relaxed);
+    valid_.store(0, std::memory_order_relaxed);
+  }
+
+  template <class T> bool cached(parse_t ty, T& ret) const {
+    if (valid_.load(std::memory_order_acquire) & (1u << ty)){
+      ret = load(ty, (T*)nullptr);
+      return true;
+    }
+    return false;
+  }
+
+  template <class T> void cache(parse_t ty, T val){
+    uint32_t bit = 1u << ty;
+    //only the first thread to parse a value publishes it
+    if (claimed_.fetch_or(bit, std::memory_order_relaxed) & bit) return;
+    store(ty, val);
+    valid_.fetch_or(bit, std::memory_order_release);
+  }
+
+  std::string value;
+  bool read;
+
+ private:
+  long load(parse_t ty, long*) const { return slots_[ty].i; }
+  double load(parse_t ty, double*) const { return slots_[ty].d; }
+  bool load(parse_t ty, bool*) const { return slots_[ty].i; }
+  void store(parse_t ty, long v){ slots_[ty].i = v; }
+  void store(parse_t ty, double v){ slots_[ty].d = v; }
+  void store(parse_t ty, bool v){ slots_[ty].i = v; }
+
+  union slot_t {
+    long i;
+    double d;
+  };
+  slot_t slots_[num_parse_types];
+  std::atomic<uint32_t> claimed_;
+  std::atomic<uint32_t> valid_;
+};
+
+/**
+ * Process-wide counters for parameter reads, reported with --sim-stats
+ */
+struct ParamStats {
+  uint64_t lookups;
+  uint64_t misses;
+  uint64_t parses;
+  uint64_t cacheHits;
+  ParamStats() : lookups(0), misses(0), parses(0), cacheHits(0) {}
+};
+
 class ParamAssign {
  public:
-  ParamAssign(std::string& p, const std::string& k) :
-    param_(p), key_(k)
+  ParamAssign(ParamEntry& p, const std::string& k) :
+    entry_(p), key_(k)
   {
   }
 
   void operator=(int a);
   void operator=(double x);
   void operator=(const std::string& str){
-    param_ = str;
+    entry_.assign(str);
   }
 
   const std::string& setByteLength(long x, const char* units);
@@ -109,11 +197,11 @@ class ParamAssign {
   operator double() const;
 
   operator std::string() const {
-    return param_;
+    return entry_.value;
   }
 
  private:
-  std::string& param_;
+  ParamEntry& entry_;
   const std::string& key_;
 
 };
@@ -132,12 +220,7 @@ class SimParameters  {
   using ptr = std::shared_ptr<SimParameters>;
   using const_ptr = std::shared_ptr<const SimParameters>;
 
-  struct parameter_entry
-  {
-    parameter_entry() : read(false) {}
-    std::string value;
-    bool read;
-  };
+  using parameter_entry = ParamEntry;
 
   bool empty() const {
     return params_.empty();
@@ -233,6 +316,12 @@ class SimParameters  {
 
   bool hasParam(const std::string& key) const;
 
+  /**
+   * @return Counts of parameter lookups and string parses
+   *         made by all parameter objects in this process
+   */
+  static ParamStats stats();
+
   int getIntParam(const std::string& key);
 
   /// Return the value of the keyword if it exists. Otherwise return
@@ -264,6 +353,13 @@ class SimParameters  {
 
   double getOptionalQuantity(const std::string& key, double def);
 
+  /**
+   @param key The parameter name
+   @param ret The parsed quantity, only set if the parameter exists
+   @return Whether the parameter exists
+  */
+  bool tryGetQuantity(const std::string& key, double& ret);
+
   double getOptionalBandwidthParam(const std::string &key, double def);
 
   double getOptionalBandwidthParam(
@@ -413,6 +509,17 @@ class SimParameters  {
 
   bool getScopedParam(std::string& inout, const std::string& key);
 
+  /**
+   * Find a parameter with a single hash lookup, marking it as read
+   * @return The entry or null if the key does not exist
+   */
+  parameter_entry* findEntry(const std::string& key);
+
+  parameter_entry& getEntry(const std::string& key);
+
+  template <class T, class Parse>
+  T parseCached(parameter_entry& entry, ParamEntry::parse_t ty, Parse&& parse);
+
   std::deque<std::string> getTokenizer(const std::string& key);
 
 };
@@ -512,6 +619,8 @@ struct UnitAlgebra
   }
 
  private:
+  friend struct CallGetParam<UnitAlgebra>;
+
   UnitAlgebra(double v) : value_(v){}
 
   double value_;
@@ -520,10 +629,15 @@ struct UnitAlgebra
 
 template <> struct CallGetParam<UnitAlgebra>  {
   static UnitAlgebra get(sprockit::SimParameters::ptr& ptr, const std::string& key){
-    return UnitAlgebra(ptr->getParam(key));
+    return UnitAlgebra(ptr->getQuantity(key));
   }
   static UnitAlgebra getOptional(sprockit::SimParameters::ptr &ptr, const std::string& key, const std::string& def){
-    return UnitAlgebra(ptr->getOptionalParam(key,def));
+    double val;
+    if (ptr->tryGetQuantity(key, val)){
+      return UnitAlgebra(val);
+    } else {
+      return UnitAlgebra(def);
+    }
   }
 };
 
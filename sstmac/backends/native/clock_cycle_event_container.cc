@@ -45,7 +45,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
 #include <sstmac/common/sstmac_config.h>
-#include <sstmac/common/handler_event_queue_entry.h>
+#include <sstmac/common/event_handler.h>
 #if !SSTMAC_INTEGRATED_SST_CORE
 #include <sstmac/backends/native/clock_cycle_event_container.h>
 #include <sstmac/hardware/switch/network_switch.h>
@@ -192,6 +192,7 @@ ClockCycleEventMap::run()
   }
   computeFinalTime(now_);
   if (rt_->me() == 0) printf("Ran %" PRIu64 " epochs on MPI parallel\n", epoch);
+  finalizeStatsOutput();
 }
 
 void
@@ -323,9 +323,16 @@ Manager::stop()
 }
 
 
+uint64_t
+Manager::numEvents() const
+{
+  return EventManager_->numEvents();
+}
+
 void
 Manager::finish()
 {
+  EventManager_->writeProfile();
   EventManager_->finishStats();
   EventManager::global = nullptr;
 }
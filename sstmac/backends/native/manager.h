@@ -86,6 +86,8 @@ class Manager {
     return interconnect_;
   }
 
+  uint64_t numEvents() const;
+
  private:
   void start();
 
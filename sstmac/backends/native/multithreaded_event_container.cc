@@ -375,6 +375,7 @@ MultithreadedEventContainer::run()
   }
 
   computeFinalTime(final_time);
+  finalizeStatsOutput();
 }
 
 
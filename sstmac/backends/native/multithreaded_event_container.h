@@ -105,6 +105,28 @@ class MultithreadedEventContainer :
 
   void scheduleStop(Timestamp until) override;
 
+  uint64_t numEvents() const override {
+    uint64_t total = num_events_;
+    for (EventManager* mgr : thread_managers_){
+      total += mgr->numEvents();
+    }
+    return total;
+  }
+
+  void collectProfile(EventProfiler& total) const override {
+    EventManager::collectProfile(total);
+    for (EventManager* mgr : thread_managers_){
+      mgr->collectProfile(total);
+    }
+  }
+
+  void collectStatGroups(std::vector<StatisticGroup*>& groups, bool partial) const override {
+    for (EventManager* mgr : thread_managers_){
+      mgr->collectStatGroups(groups, partial);
+    }
+    EventManager::collectStatGroups(groups, partial);
+  }
+
   EventManager* threadManager(int thr) const override {
     if (thr == num_subthreads_) {
       return const_cast<MultithreadedEventContainer*>(this);
@@ -50,6 +50,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/common/sst_event_fwd.h>
 #include <sstmac/common/event_handler_fwd.h>
 #include <sprockit/printable.h>
+#include <sprockit/object_pool.h>
 #include <tuple>
 
 #if SSTMAC_INTEGRATED_SST_CORE
@@ -68,8 +69,42 @@ class EventHandler : public sprockit::printable
 
   virtual void handle(Event* ev) = 0;
 
+  /**
+   * Deliver an event. Handlers bound to their target at compile time
+   * are called through a plain function pointer that inlines the member call,
+   * all others go through the virtual handle().
+   * @param ev The event to deliver, ownership passes to the handler
+   */
+  void invoke(Event* ev){
+    if (trampoline_){
+      (*trampoline_)(target_, ev);
+    } else {
+      handle(ev);
+    }
+  }
+
  protected:
-  EventHandler() {}
+  using Trampoline = void (*)(void*, Event*);
+
+  EventHandler() :
+    target_(nullptr),
+    trampoline_(nullptr)
+  {
+  }
+
+  EventHandler(void* target, Trampoline tramp) :
+    target_(target),
+    trampoline_(tramp)
+  {
+  }
+
+  void* target() const {
+    return target_;
+  }
+
+ private:
+  void* target_;
+  Trampoline trampoline_;
 
 };
 
@@ -158,6 +193,42 @@ class MemberFxnHandler : public EventHandler
 
 };
 
+/**
+ * A link handler with the receiving member function fixed as a template
+ * parameter. The handler is only a (target, trampoline) pair drawn from a
+ * per-type pool, so building one per port in a large topology is cheap,
+ * and delivery is a single indirect call the compiler can inline through.
+ */
+template <class Cls, void (Cls::*Fxn)(Event*)>
+class BoundLinkHandler final :
+  public EventHandler,
+  public sprockit::ObjectPool<BoundLinkHandler<Cls,Fxn>>
+{
+ public:
+  explicit BoundLinkHandler(Cls* obj) :
+    EventHandler(obj, &BoundLinkHandler::trampoline)
+  {
+  }
+
+  std::string toString() const override {
+    return obj()->toString();
+  }
+
+  void handle(Event* ev) override {
+    (obj()->*Fxn)(ev);
+  }
+
+ private:
+  Cls* obj() const {
+    return static_cast<Cls*>(target());
+  }
+
+  static void trampoline(void* obj, Event* ev){
+    (static_cast<Cls*>(obj)->*Fxn)(ev);
+  }
+
+};
+
 template<class Cls, typename Fxn, class ...Args>
 EventHandler* newHandler(Cls* cls, Fxn fxn, const Args&... args)
 {
@@ -46,22 +46,44 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/common/event_manager.h>
 #include <sstmac/common/sst_event.h>
 #include <sstmac/common/stats/stat_collector.h>
+#include <sstmac/common/stats/stat_merge.h>
 #include <sstmac/hardware/interconnect/interconnect.h>
 #include <sstmac/backends/common/sim_partition.h>
 #include <sstmac/backends/common/parallel_runtime.h>
 #include <sstmac/software/threading/threading_interface.h>
 #include <sstmac/software/threading/stack_alloc.h>
 #include <sstmac/software/process/operating_system.h>
-#include <sstmac/common/handler_event_queue_entry.h>
+#include <sstmac/common/event_handler.h>
+#include <sstmac/common/event_profiler.h>
 #include <sprockit/util.h>
 #include <sprockit/output.h>
 #include <sprockit/thread_safe_new.h>
+#include <sprockit/keyword_registration.h>
 #include <limits>
+#include <atomic>
+#include <thread>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <cinttypes>
 
 RegisterDebugSlot(event_manager);
 
+RegisterKeywords(
+{ "snapshot_time", "simulated time at which to snapshot a serial run, e.g. after application warm-up" },
+{ "snapshot_restarts", "the number of times to resume the simulation from the snapshot" },
+{ "snapshot_restart_params", "a list of parameter files, one per restart, each applied on top of the snapshot parameters" },
+{ "snapshot_output_prefix", "prefix for the statistics files of each restart, followed by the restart number" },
+{ "event_profile", "whether to time every event by handler type, component and link class" },
+{ "event_profile_file", "a CSV or .json file to write the event profile to, turns on event_profile" },
+{ "event_profile_queue_interval", "sample the event queue size every this many events" },
+{ "stats_output_threads", "the number of threads writing statistics at the end of the run" },
+);
+
 #define prll_debug(...) \
   debug_printf(sprockit::dbg::parallel, "LP %d: %s", rt_->me(), sprockit::sprintf(__VA_ARGS__).c_str())
 
@@ -107,6 +129,7 @@ void runEventmanagerThread(void* argPtr)
 
 EventManager::EventManager(SST::Params& params, ParallelRuntime *rt) :
   pendingSlot_(0),
+  pendingEpoch_(1),
   complete_(false),
   rt_(rt),
   interconn_(nullptr),
@@ -114,8 +137,18 @@ EventManager::EventManager(SST::Params& params, ParallelRuntime *rt) :
   me_(rt->me()),
   nproc_(rt->nproc()),
   nthread_(rt->nthread()),
-  thread_id_(0)
+  thread_id_(0),
+  num_events_(0),
+  profiler_(nullptr),
+  snapshot_restarts_(0),
+  snapshot_fd_(-1)
 {
+  int hw_threads = std::thread::hardware_concurrency();
+  stats_output_threads_ = params.find<int>("stats_output_threads", std::max(1, hw_threads));
+  if (stats_output_threads_ < 1){
+    spkt_abort_printf("stats_output_threads must be at least 1, got %d", stats_output_threads_);
+  }
+
   for (int i=0; i < num_pendingSlots; ++i){
     pending_events_[i].resize(nthread_);
   }
@@ -132,11 +165,39 @@ EventManager::EventManager(SST::Params& params, ParallelRuntime *rt) :
 
   //make sure there's a good bit of space
   pending_serialization_.reserve(1024);
+
+  if (params.find<bool>("event_profile", false) || params.contains("event_profile_file")){
+    profiler_ = new EventProfiler(params.find<long>("event_profile_queue_interval", 1024));
+    profile_file_ = params.find<std::string>("event_profile_file", "");
+  }
+
+  if (params.contains("snapshot_time")){
+    if (nproc_ > 1 || nthread_ > 1){
+      spkt_abort_printf("snapshot_time is only supported for serial runs, "
+                        "got %d ranks and %d threads", nproc_, int(nthread_));
+    }
+    snapshot_time_ = Timestamp(params.find<SST::UnitAlgebra>("snapshot_time").getValue().toDouble());
+    if (params.contains("snapshot_restart_params")){
+      params.find_array("snapshot_restart_params", snapshot_overlays_);
+    }
+    int default_restarts = snapshot_overlays_.empty() ? 1 : int(snapshot_overlays_.size());
+    snapshot_restarts_ = params.find<int>("snapshot_restarts", default_restarts);
+    if (snapshot_restarts_ < 1){
+      spkt_abort_printf("snapshot_restarts must be at least 1, got %d", snapshot_restarts_);
+    }
+    if (!snapshot_overlays_.empty() && snapshot_overlays_.size() != snapshot_restarts_){
+      spkt_abort_printf("snapshot_restart_params gives %d parameter files for %d restarts",
+                        int(snapshot_overlays_.size()), snapshot_restarts_);
+    }
+    snapshot_prefix_ = params.find<std::string>("snapshot_output_prefix", "restart");
+    snapshot_params_ = params;
+  }
 }
 
 EventManager::~EventManager()
 {
   if (des_context_) delete des_context_;
+  if (profiler_) delete profiler_;
   for (auto& pair : stat_groups_){
     StatisticGroup* grp = pair.second;
     for (auto* stat : grp->stats){
@@ -160,8 +221,12 @@ void
 EventManager::stop()
 {
   printf("Shutting down simulation at t=%20.12fs\n", now().sec());
-  for (ExecutionEvent* ev : event_queue_){
-    delete ev;
+  for (Event* ev : event_queue_){
+    while (ev){
+      Event* next = ev->batchNext();
+      delete ev;
+      ev = next;
+    }
   }
   event_queue_.clear();
   min_ipc_time_ = no_events_left_time;
@@ -183,7 +248,7 @@ EventManager::runEvents(Timestamp event_horizon)
              me_, thread_id_, event_horizon.sec(), event_queue_.size(), epoch());
   while (!event_queue_.empty()){
     auto iter = event_queue_.begin();
-    ExecutionEvent* ev = *iter;
+    Event* ev = *iter;
     prll_debug("manager %d:%d pulled event %" PRIu32 " from link %" PRIu64 " at t=%10.7e on epoch %d",
                 me_, thread_id_, ev->seqnum(), ev->linkId(), ev->time().sec(), epoch());
 #if SSTMAC_SANITY_CHECK
@@ -199,8 +264,44 @@ EventManager::runEvents(Timestamp event_horizon)
     } else {
       now_ = ev->time();
       event_queue_.erase(iter);
-      ev->execute();
-      delete ev;
+      ++num_events_;
+      EventHandler* handler = ev->handler();
+      uint64_t t_start = 0;
+      if (profiler_){
+        profiler_->recordQueue(now_, event_queue_.size());
+        t_start = EventProfiler::cycles();
+      }
+      if (handler){
+        //the event is handed off, the handler now owns it
+        uint64_t num_handled = 1;
+        uint32_t link_id = ev->linkId();
+        Event* next = ev->batchNext();
+        ev->setBatchNext(nullptr);
+        handler->invoke(ev);
+        while (next){
+          //a handler may have queued an event at this time that orders before the rest of the chain
+          if (!event_queue_.empty() && EventCompare()(*event_queue_.begin(), next)){
+            event_queue_.insert(next);
+            break;
+          }
+          ev = next;
+          next = ev->batchNext();
+          ev->setBatchNext(nullptr);
+          ++num_events_;
+          ++num_handled;
+          handler->invoke(ev);
+        }
+        if (profiler_){
+          profiler_->recordHandler(handler, link_id, num_handled, EventProfiler::cycles() - t_start);
+        }
+      } else {
+        ExecutionEvent* xev = static_cast<ExecutionEvent*>(ev);
+        xev->execute();
+        if (profiler_){
+          profiler_->recordExecution(xev, EventProfiler::cycles() - t_start);
+        }
+        delete xev;
+      }
     }
   }
   return min_ipc_time_;
@@ -239,6 +340,7 @@ EventManager::registerStatisticCore(StatisticBase* base, SST::Params& params)
   StatisticGroup* grp = stat_groups_[base->groupName()];
   if (!grp){
     grp = new StatisticGroup(base->groupName());
+    grp->prefix = output_prefix_;
     stat_groups_[base->groupName()] = grp;
   }
 
@@ -265,19 +367,124 @@ EventManager::finalizeStatsInit()
 {
 }
 
+static const int stat_chunk_size = 1 << 30;
+
 void
-EventManager::finalizeStatsOutput()
+EventManager::collectStatGroups(std::vector<StatisticGroup*>& groups, bool partial) const
 {
   for (auto& pair : stat_groups_){
     StatisticGroup* grp = pair.second;
+    grp->partition = partial ? sprockit::sprintf(".%d.%d", me_, thread_id_) : std::string();
+    groups.push_back(grp);
+  }
+}
+
+void
+EventManager::finalizeStatsOutput()
+{
+  //with several threads or ranks, every thread manager writes a partial file per group
+  bool partial = nproc_ > 1 || nthread_ > 1;
+  std::vector<StatisticGroup*> groups;
+  collectStatGroups(groups, partial);
+
+  //every group has its own output object and file - write them concurrently
+  parallelFor(groups.size(), stats_output_threads_, [&](int i){
+    StatisticGroup* grp = groups[i];
     grp->output->startOutputGroup(grp);
     for (auto* stat : grp->stats){
       grp->output->output(stat, true);
-      //stat->outputStatisticData(grp.output, true/*only ever end of sim*/);
-      //grp.output->stopOutputEntries();
     }
     grp->output->stopOutputGroup();
+  });
+
+  if (partial){
+    mergePartialStats(groups);
+  }
+}
+
+void
+EventManager::mergePartialStats(const std::vector<StatisticGroup*>& groups)
+{
+  //outputs that cannot be merged keep their per-thread files
+  std::map<std::string, std::vector<StatisticGroup*>> partials;
+  for (StatisticGroup* grp : groups){
+    if (!grp->output->mergeSuffix().empty()){
+      partials[grp->name].push_back(grp);
+    }
+  }
+
+  std::vector<PartialStatFiles> lists;
+  std::vector<std::vector<StatisticGroup*>*> list_groups;
+  std::vector<std::pair<int,int>> reads;
+  for (auto& pair : partials){
+    for (int i=0; i < pair.second.size(); ++i){
+      reads.emplace_back(lists.size(), i);
+    }
+    PartialStatFiles list;
+    list.output = pair.second.front()->output;
+    list.group = pair.first;
+    list.contents.resize(pair.second.size());
+    lists.push_back(std::move(list));
+    list_groups.push_back(&pair.second);
+  }
+
+  parallelFor(reads.size(), stats_output_threads_, [&](int r){
+    StatisticGroup* grp = (*list_groups[reads[r].first])[reads[r].second];
+    std::string fname = grp->fileRoot() + grp->output->mergeSuffix();
+    std::ifstream in(fname, std::ios::binary);
+    if (in){ //groups with nothing to write may never open a file
+      lists[reads[r].first].contents[reads[r].second].assign(std::istreambuf_iterator<char>(in),
+                                                             std::istreambuf_iterator<char>());
+      in.close();
+      ::remove(fname.c_str());
+    }
+  });
+
+  treeMergeThreads(lists, stats_output_threads_);
+
+  PartialStatMap merged;
+  for (int l=0; l < lists.size(); ++l){
+    StatisticGroup* grp = list_groups[l]->front();
+    PartialStat& stat = merged[grp->name];
+    stat.output = grp->output;
+    stat.outputName = grp->outputName;
+    stat.fileRoot = grp->mergedFileRoot();
+    stat.contents = std::move(lists[l].contents.front());
+  }
+
+  //the runtime only moves int-sized buffers
+  auto send = [this](int dst, const std::string& buf){
+    uint64_t size = buf.size();
+    rt_->send(dst, &size, sizeof(size));
+    for (uint64_t offset=0; offset < size; offset += stat_chunk_size){
+      int bytes = std::min<uint64_t>(stat_chunk_size, size - offset);
+      rt_->send(dst, const_cast<char*>(&buf[offset]), bytes);
+    }
+  };
+  auto recv = [this](int src, std::string& buf){
+    uint64_t size;
+    rt_->recv(src, &size, sizeof(size));
+    buf.resize(size);
+    for (uint64_t offset=0; offset < size; offset += stat_chunk_size){
+      int bytes = std::min<uint64_t>(stat_chunk_size, size - offset);
+      rt_->recv(src, &buf[offset], bytes);
+    }
+  };
+  if (!treeMergeRanks(me_, nproc_, merged, send, recv)){
+    return; //rank 0 writes the merged files
+  }
+
+  std::vector<PartialStatMap::value_type*> to_write;
+  for (auto& pair : merged){
+    if (!pair.second.contents.empty()){
+      to_write.push_back(&pair);
+    }
   }
+  parallelFor(to_write.size(), stats_output_threads_, [&](int i){
+    std::ofstream out(to_write[i]->second.fileRoot + to_write[i]->second.output->mergeSuffix(),
+                      std::ios::binary);
+    out << to_write[i]->second.contents;
+  });
 }
 
 void
@@ -303,7 +510,9 @@ EventManager::scheduleIncoming(IpcEvent* iev)
                       me(), iev->link);
   }
 #endif
-  auto qev = new HandlerExecutionEvent(iev->ev, dst_handler);
+  if (profiler_) profiler_->addIpc(1);
+  Event* qev = iev->ev;
+  qev->setHandler(dst_handler);
   qev->setSeqnum(iev->seqnum);
   qev->setTime(iev->t);
   qev->setLink(iev->link);
@@ -328,7 +537,8 @@ EventManager::registerPending()
 
   int idx = 0;
   for (auto& pendingVec : pending_events_[pendingSlot_]){
-    for (ExecutionEvent* ev : pendingVec){
+    if (profiler_) profiler_->addCrossThread(pendingVec.size());
+    for (Event* ev : pendingVec){
 #if SSTMAC_SANITY_CHECK
       if (ev->time() < now_){
         spkt_abort_printf("Thread %d scheduling event in the past on thread %d", idx, thread_id_);
@@ -342,6 +552,7 @@ EventManager::registerPending()
     ++idx;
   }
   pendingSlot_ = (pendingSlot_+1) % num_pendingSlots;
+  ++pendingEpoch_;
 }
 
 static int nactive_threads = 0;
@@ -402,13 +613,142 @@ EventManager::run()
 
   registerPending();
 
+  if (snapshot_restarts_ > 0){
+    //stop short of the snapshot time, a run that is already done has nothing to snapshot
+    runEvents(snapshot_time_);
+    if (event_queue_.empty()){
+      cout0 << sprockit::sprintf("Simulation finished before the snapshot time of %20.12fs\n",
+                                 snapshot_time_.sec());
+    } else {
+      takeSnapshot();
+    }
+  }
+
   runEvents(no_events_left_time);
 
   final_time_ = now_;
 
+  if (snapshot_fd_ >= 0){
+    uint64_t ticks = final_time_.time.ticks();
+    if (::write(snapshot_fd_, &ticks, sizeof(ticks)) != sizeof(ticks)){
+      spkt_abort_printf("restart failed to report its final time to the snapshot");
+    }
+    ::close(snapshot_fd_);
+  }
+
   finalizeStatsOutput();
 }
 
+void
+EventManager::takeSnapshot()
+{
+  //the whole address space - event queues, component state, user-thread stacks
+  //and global segments - is the snapshot, every restart gets a copy-on-write image
+  cout0 << sprockit::sprintf("Snapshot at t=%20.12fs, resuming %d times\n",
+                             now_.sec(), snapshot_restarts_);
+  fflush(stdout);
+  fflush(stderr);
+
+  std::vector<uint64_t> final_ticks(snapshot_restarts_);
+  for (int r=0; r < snapshot_restarts_; ++r){
+    int fds[2];
+    if (::pipe(fds) != 0){
+      spkt_abort_printf("failed creating pipe for snapshot restart %d", r);
+    }
+    pid_t pid = ::fork();
+    if (pid < 0){
+      spkt_abort_printf("failed forking snapshot restart %d", r);
+    } else if (pid == 0){
+      ::close(fds[0]);
+      snapshot_fd_ = fds[1];
+      startRestart(r);
+      return; //the restart runs the rest of the simulation
+    }
+
+    ::close(fds[1]);
+    uint64_t ticks = 0;
+    bool reported = ::read(fds[0], &ticks, sizeof(ticks)) == sizeof(ticks);
+    ::close(fds[0]);
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+    if (!reported || !WIFEXITED(status) || WEXITSTATUS(status) != 0){
+      cerr0 << sprockit::sprintf("Snapshot restart %d did not complete\n", r);
+      _exit(1);
+    }
+    final_ticks[r] = ticks;
+  }
+
+  for (int r=0; r < snapshot_restarts_; ++r){
+    cout0 << sprockit::sprintf("Restart %d finished at t=%20.12fs\n", r,
+                               Timestamp(0, final_ticks[r]).sec());
+    //restarts with the same parameters must reproduce each other exactly
+    if (snapshot_overlays_.empty() && final_ticks[r] != final_ticks[0]){
+      cerr0 << sprockit::sprintf("Snapshot restart %d finished at %" PRIu64 " ticks, "
+                                 "but restart 0 finished at %" PRIu64 " ticks\n",
+                                 r, final_ticks[r], final_ticks[0]);
+      _exit(1);
+    }
+  }
+  fflush(stdout);
+  //the restarts did all the work, the snapshot never runs past this point
+  _exit(0);
+}
+
+void
+EventManager::startRestart(int r)
+{
+  if (!snapshot_overlays_.empty()){
+    //anything that reads its parameters after the snapshot sees the overlay
+    snapshot_params_->parseFile(snapshot_overlays_[r], false, true);
+  }
+  output_prefix_ = sprockit::sprintf("%s%d.", snapshot_prefix_.c_str(), r);
+  for (auto& pair : stat_groups_){
+    pair.second->prefix = output_prefix_;
+  }
+  if (!profile_file_.empty()){
+    size_t slash = profile_file_.find_last_of('/');
+    profile_file_.insert(slash == std::string::npos ? 0 : slash + 1, output_prefix_);
+  }
+}
+
+void
+EventManager::addLinkClass(uint64_t first, uint64_t end, const std::string& name)
+{
+  for (int i=0; i < nthread(); ++i){
+    EventProfiler* prof = threadManager(i)->profiler_;
+    if (prof) prof->addLinkClass(first, end, name);
+  }
+}
+
+void
+EventManager::collectProfile(EventProfiler& total) const
+{
+  if (profiler_) total.merge(*profiler_);
+}
+
+void
+EventManager::writeProfile()
+{
+  if (!profiler_) return;
+
+  EventProfiler total(1);
+  collectProfile(total);
+  if (me_ == 0){
+    total.report(std::cout, 20);
+  }
+  if (!profile_file_.empty()){
+    std::string fname = profile_file_;
+    if (nproc_ > 1){
+      //one file per rank, e.g. profile.csv -> profile.3.csv
+      size_t dot = fname.find_last_of('.');
+      std::string rank = sprockit::sprintf(".%d", me_);
+      if (dot == std::string::npos) fname += rank;
+      else fname.insert(dot, rank);
+    }
+    total.writeFile(fname);
+  }
+}
+
 void
 EventManager::ipcSchedule(IpcEvent* iev)
 {
@@ -437,7 +777,7 @@ EventManager::finishStats()
 }
 
 void 
-EventManager::schedule(ExecutionEvent* ev){
+EventManager::schedule(Event* ev){
 #if SSTMAC_SANITY_CHECK
   if (ev->time() < now_){
     spkt_abort_printf("Time went backwards on manager %d:%d to t=%10.6e for link=%" PRIu64 " seq=%" PRIu32,
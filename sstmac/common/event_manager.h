@@ -57,7 +57,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/common/event_scheduler.h>
 #include <sstmac/common/sst_event_fwd.h>
 #include <sstmac/common/stats/stat_collector_fwd.h>
-#include <sprockit/sim_parameters_fwd.h>
+#include <sprockit/sim_parameters.h>
 #include <sprockit/factory.h>
 #include <sprockit/debug.h>
 #include <sprockit/allocator.h>
@@ -83,6 +83,8 @@ namespace sstmac {
 
 #if SSTMAC_INTEGRATED_SST_CORE
 #else
+class EventProfiler;
+
 /**
  * Base type for implementations of an engine that
  * is able to schedule events and advance simulation time
@@ -154,6 +156,38 @@ class EventManager
     return final_time_;
   }
 
+  /**
+   * @return The number of events executed by this manager (and any thread managers it owns)
+   */
+  virtual uint64_t numEvents() const {
+    return num_events_;
+  }
+
+  /**
+   * Fold the event profile of this manager (and any thread managers it owns) into total
+   */
+  virtual void collectProfile(EventProfiler& total) const;
+
+  /**
+   * Print the event profile and write the profile file, if profiling is on
+   */
+  void writeProfile();
+
+  /**
+   * Name a range of link ids for the event profile, if profiling is on
+   * @param first The first link id in the class
+   * @param end   One past the last link id in the class
+   * @param name  The name of the class in the profile
+   */
+  void addLinkClass(uint64_t first, uint64_t end, const std::string& name);
+
+  /**
+   * Append the statistic groups of this manager (and any thread managers it owns)
+   * @param groups  The list to append to
+   * @param partial Whether each thread writes a partial output to be merged
+   */
+  virtual void collectStatGroups(std::vector<StatisticGroup*>& groups, bool partial) const;
+
   /** 
    * @return The MPI rank of this event manager 
    * */
@@ -189,7 +223,7 @@ class EventManager
 
   void ipcSchedule(IpcEvent* iev);
 
-  void multithreadSchedule(int slot, int srcThread, ExecutionEvent* ev){
+  void multithreadSchedule(int slot, int srcThread, Event* ev){
     pending_events_[slot][srcThread].push_back(ev);
   }
 
@@ -201,7 +235,19 @@ class EventManager
     return pendingSlot_;
   }
 
-  void schedule(ExecutionEvent* ev);
+  /**
+   * @return The number of times pending cross-thread events have been registered,
+   *         i.e. a counter that changes every epoch
+   */
+  uint64_t pendingEpoch() const {
+    return pendingEpoch_;
+  }
+
+  /**
+   * Add an event to the queue. The time, link, seqnum and (for handler events)
+   * the handler must already be set on the event.
+   */
+  void schedule(Event* ev);
 
   void setInterconnect(hw::Interconnect* ic);
 
@@ -249,7 +295,23 @@ class EventManager
 
   void addLinkHandler(uint64_t linkId, EventHandler* handler);
 
+  /**
+   * @brief takeSnapshot
+   * Fork the simulator at the current time. The parent process holds the
+   * snapshot and resumes the simulation once per restart in a child process,
+   * then reports the final time of every restart. Restarts without parameter
+   * overlays must all reach the same final time. Only valid for serial runs.
+   */
+  void takeSnapshot();
+
  protected:
+  /**
+   * @brief startRestart
+   * Apply the parameter overlay and output prefix of a restart
+   * @param r The restart number
+   */
+  void startRestart(int r);
+
   void registerPending();
 
   virtual Timestamp receiveIncomingEvents(Timestamp vote) {
@@ -258,7 +320,8 @@ class EventManager
 
 #define num_pendingSlots 4
   int pendingSlot_;
-  std::vector<std::vector<ExecutionEvent*>> pending_events_[num_pendingSlots];
+  uint64_t pendingEpoch_;
+  std::vector<std::vector<Event*>> pending_events_[num_pendingSlots];
   std::vector<char*> pending_serialization_;
 
  protected:
@@ -280,6 +343,26 @@ class EventManager
   TimeDelta lookahead_;
   Timestamp now_;
 
+  uint64_t num_events_;
+
+  /** Per-handler event timing, null unless event_profile is on */
+  EventProfiler* profiler_;
+  std::string profile_file_;
+
+  Timestamp snapshot_time_;
+  int snapshot_restarts_;
+  /** Pipe for a restart to report its final time, -1 if not a restart */
+  int snapshot_fd_;
+  /** Parameter file applied by each restart, empty if restarts share parameters */
+  std::vector<std::string> snapshot_overlays_;
+  std::string snapshot_prefix_;
+  SST::Params snapshot_params_;
+  /** Prefix for statistics files, set in each restart */
+  std::string output_prefix_;
+
+  /** The number of threads writing statistic groups at the end of the run */
+  int stats_output_threads_;
+
  private:
 #define MAX_EVENT_MGR_THREADS 128
   std::vector<MacroBaseComponent*> pending_registration_[MAX_EVENT_MGR_THREADS];
@@ -287,8 +370,14 @@ class EventManager
  protected:
   Timestamp min_ipc_time_;
 
+  /**
+   * Write all statistic groups concurrently, then merge the partial outputs
+   * of different threads and ranks into a single file per group
+   */
   void finalizeStatsOutput();
 
+  void mergePartialStats(const std::vector<StatisticGroup*>& groups);
+
   void finalizeStatsInit();
 
   void scheduleIncoming(IpcEvent* iev);
@@ -296,7 +385,7 @@ class EventManager
   int serializeSchedule(char* buf);
 
   struct EventCompare {
-    bool operator()(ExecutionEvent* lhs, ExecutionEvent* rhs) const {
+    bool operator()(Event* lhs, Event* rhs) const {
       bool neq = lhs->time() != rhs->time();
       if (neq) return lhs->time() < rhs->time();
 
@@ -307,8 +396,8 @@ class EventManager
       }
     }
   };
-  using queue_t = std::set<ExecutionEvent*, EventCompare,
-                    sprockit::allocator<ExecutionEvent*>> ;
+  using queue_t = std::set<Event*, EventCompare,
+                    sprockit::allocator<Event*>> ;
   queue_t event_queue_;
 
   StatisticOutput* dflt_stat_output_;
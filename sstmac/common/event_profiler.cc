@@ -0,0 +1,303 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+
+#include <sstmac/common/event_profiler.h>
+#include <sstmac/common/event_handler.h>
+#include <sstmac/common/sst_event.h>
+#include <sstmac/libraries/nlohmann/json.hpp>
+#include <sprockit/errors.h>
+#include <sprockit/util.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <fstream>
+#include <map>
+
+namespace sstmac {
+
+static std::string
+demangledName(const std::type_info& info)
+{
+  int status;
+  char* name = abi::__cxa_demangle(info.name(), nullptr, nullptr, &status);
+  if (status != 0 || !name) return info.name();
+  std::string ret(name);
+  free(name);
+  return ret;
+}
+
+EventProfiler::EventProfiler(uint64_t queue_sample_interval) :
+  queue_sample_interval_(std::max(queue_sample_interval, uint64_t(1))),
+  since_sample_(0),
+  max_queue_(0),
+  cross_thread_events_(0),
+  ipc_events_(0)
+{
+  link_classes_.emplace_back();
+  link_classes_.back().component = "self links";
+}
+
+void
+EventProfiler::addLinkClass(uint64_t first, uint64_t end, const std::string& name)
+{
+  if (first == end) return;
+
+  int idx = 0;
+  while (idx < int(link_classes_.size()) && link_classes_[idx].component != name) ++idx;
+  if (idx == int(link_classes_.size())){
+    link_classes_.emplace_back();
+    link_classes_.back().component = name;
+  }
+  link_ranges_[first] = std::make_pair(end, idx);
+}
+
+EventProfiler::Entry&
+EventProfiler::linkClass(uint32_t link_id)
+{
+  auto iter = link_ranges_.upper_bound(link_id);
+  if (iter != link_ranges_.begin()){
+    --iter;
+    if (link_id < iter->second.first){
+      return link_classes_[iter->second.second];
+    }
+  }
+  return link_classes_[0];
+}
+
+EventProfiler::HandlerMap::iterator
+EventProfiler::addHandler(EventHandler* handler)
+{
+  Entry& e = handlers_[handler];
+  e.type = demangledName(typeid(*handler));
+  e.component = handler->toString();
+  return handlers_.find(handler);
+}
+
+void
+EventProfiler::recordExecution(ExecutionEvent* ev, uint64_t cycles)
+{
+  std::type_index idx(typeid(*ev));
+  auto iter = executions_.find(idx);
+  if (iter == executions_.end()){
+    Entry& e = executions_[idx];
+    e.type = demangledName(typeid(*ev));
+    e.component = "self events";
+    iter = executions_.find(idx);
+  }
+  iter->second.events += 1;
+  iter->second.cycles += cycles;
+}
+
+void
+EventProfiler::merge(const EventProfiler& other)
+{
+  for (auto& pair : other.handlers_){
+    Entry& e = handlers_[pair.first];
+    e.type = pair.second.type;
+    e.component = pair.second.component;
+    e.events += pair.second.events;
+    e.cycles += pair.second.cycles;
+  }
+  for (auto& pair : other.executions_){
+    Entry& e = executions_[pair.first];
+    e.type = pair.second.type;
+    e.component = pair.second.component;
+    e.events += pair.second.events;
+    e.cycles += pair.second.cycles;
+  }
+  for (const Entry& other_link : other.link_classes_){
+    auto iter = std::find_if(link_classes_.begin(), link_classes_.end(),
+                [&](const Entry& e){ return e.component == other_link.component; });
+    if (iter == link_classes_.end()){
+      link_classes_.push_back(other_link);
+    } else {
+      iter->events += other_link.events;
+      iter->cycles += other_link.cycles;
+    }
+  }
+  queue_samples_.insert(queue_samples_.end(),
+                        other.queue_samples_.begin(), other.queue_samples_.end());
+  std::sort(queue_samples_.begin(), queue_samples_.end(),
+            [](const QueueSample& a, const QueueSample& b){ return a.time < b.time; });
+  max_queue_ = std::max(max_queue_, other.max_queue_);
+  cross_thread_events_ += other.cross_thread_events_;
+  ipc_events_ += other.ipc_events_;
+}
+
+std::vector<EventProfiler::Entry>
+EventProfiler::aggregate(bool by_type) const
+{
+  std::map<std::string, Entry> sums;
+  auto add = [&](const Entry& e){
+    const std::string& key = by_type ? e.type : e.component;
+    Entry& sum = sums[key];
+    sum.type = e.type;
+    sum.component = e.component;
+    sum.events += e.events;
+    sum.cycles += e.cycles;
+  };
+  for (auto& pair : handlers_) add(pair.second);
+  for (auto& pair : executions_) add(pair.second);
+
+  std::vector<Entry> ret;
+  ret.reserve(sums.size());
+  for (auto& pair : sums) ret.push_back(pair.second);
+  std::sort(ret.begin(), ret.end(),
+            [](const Entry& a, const Entry& b){ return a.cycles > b.cycles; });
+  return ret;
+}
+
+std::vector<EventProfiler::Entry>
+EventProfiler::linkClasses() const
+{
+  std::vector<Entry> ret;
+  for (const Entry& e : link_classes_){
+    if (e.events) ret.push_back(e);
+  }
+  std::sort(ret.begin(), ret.end(),
+            [](const Entry& a, const Entry& b){ return a.cycles > b.cycles; });
+  return ret;
+}
+
+void
+EventProfiler::report(std::ostream& os, int max_rows) const
+{
+  uint64_t total_cycles = 0;
+  uint64_t total_events = 0;
+  uint64_t self_events = 0;
+  for (auto& pair : handlers_){
+    total_cycles += pair.second.cycles;
+    total_events += pair.second.events;
+  }
+  for (auto& pair : executions_){
+    total_cycles += pair.second.cycles;
+    total_events += pair.second.events;
+    self_events += pair.second.events;
+  }
+  if (total_events == 0) return;
+
+  auto print = [&](const char* title, const std::vector<Entry>& entries, bool by_type){
+    os << title << "\n";
+    int rows = 0;
+    for (const Entry& e : entries){
+      if (rows++ == max_rows) break;
+      os << sprockit::sprintf("  %6.2f%% %14llu cycles %12llu events %10.1f cycles/event  %s\n",
+                              100.0 * e.cycles / total_cycles,
+                              (unsigned long long) e.cycles, (unsigned long long) e.events,
+                              double(e.cycles) / e.events,
+                              (by_type ? e.type : e.component).c_str());
+    }
+  };
+
+  os << sprockit::sprintf("Event profile: %llu events in %llu cycles\n",
+                          (unsigned long long) total_events, (unsigned long long) total_cycles);
+  print("By handler type:", aggregate(true), true);
+  print("By component:", aggregate(false), false);
+  print("By link class:", linkClasses(), false);
+
+  uint64_t link_events = total_events - self_events;
+  uint64_t remote = cross_thread_events_ + ipc_events_;
+  uint64_t local = link_events > remote ? link_events - remote : 0;
+  os << sprockit::sprintf("By origin: %llu self, %llu local link, %llu cross-thread, %llu cross-rank events\n",
+                          (unsigned long long) self_events, (unsigned long long) local,
+                          (unsigned long long) cross_thread_events_, (unsigned long long) ipc_events_);
+  os << sprockit::sprintf("Event queue: max %llu events, %llu samples\n",
+                          (unsigned long long) max_queue_, (unsigned long long) queue_samples_.size());
+}
+
+void
+EventProfiler::writeFile(const std::string& fname) const
+{
+  std::ofstream ofs(fname);
+  if (!ofs.is_open()){
+    spkt_abort_printf("could not open event profile file %s", fname.c_str());
+  }
+
+  std::vector<Entry> by_component = aggregate(false);
+  bool json = fname.size() > 5 && fname.compare(fname.size() - 5, 5, ".json") == 0;
+  if (json){
+    nlohmann::json js;
+    for (const Entry& e : by_component){
+      nlohmann::json row;
+      row["component"] = e.component;
+      row["type"] = e.type;
+      row["events"] = e.events;
+      row["cycles"] = e.cycles;
+      js["components"].push_back(row);
+    }
+    for (const Entry& e : aggregate(true)){
+      nlohmann::json row;
+      row["type"] = e.type;
+      row["events"] = e.events;
+      row["cycles"] = e.cycles;
+      js["types"].push_back(row);
+    }
+    for (const Entry& e : linkClasses()){
+      nlohmann::json row;
+      row["link_class"] = e.component;
+      row["events"] = e.events;
+      row["cycles"] = e.cycles;
+      js["links"].push_back(row);
+    }
+    js["origin"]["cross_thread"] = cross_thread_events_;
+    js["origin"]["cross_rank"] = ipc_events_;
+    js["queue"]["max"] = max_queue_;
+    for (const QueueSample& s : queue_samples_){
+      js["queue"]["samples"].push_back({s.time, s.size});
+    }
+    ofs << js.dump(2) << std::endl;
+  } else {
+    ofs << "group,name,type,events,cycles\n";
+    for (const Entry& e : by_component){
+      ofs << "component,\"" << e.component << "\",\"" << e.type << "\","
+          << e.events << "," << e.cycles << "\n";
+    }
+    for (const Entry& e : linkClasses()){
+      ofs << "link,\"" << e.component << "\",," << e.events << "," << e.cycles << "\n";
+    }
+  }
+}
+
+}
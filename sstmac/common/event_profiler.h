@@ -0,0 +1,187 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+
+#ifndef SSTMAC_COMMON_EVENT_PROFILER_H_INCLUDED
+#define SSTMAC_COMMON_EVENT_PROFILER_H_INCLUDED
+
+#include <sstmac/common/timestamp.h>
+#include <sstmac/common/event_handler_fwd.h>
+#include <sstmac/common/sst_event_fwd.h>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#if !defined(__x86_64__) && !defined(__i386__)
+#include <chrono>
+#endif
+
+namespace sstmac {
+
+/**
+ * Attributes the host time spent in each event to the handler that ran it
+ * and to the class of link it arrived on.
+ * One profiler lives on each event manager thread, so recording needs no locks.
+ * Names of handlers and components are resolved the first time a handler is seen.
+ * Afterwards each event costs two lookups and two cycle counter reads.
+ */
+class EventProfiler
+{
+ public:
+  struct Entry {
+    std::string type;
+    std::string component;
+    uint64_t events = 0;
+    uint64_t cycles = 0;
+  };
+
+  struct QueueSample {
+    double time;
+    uint64_t size;
+  };
+
+  static inline uint64_t cycles(){
+#if defined(__x86_64__) || defined(__i386__)
+    uint32_t hi, lo;
+    __asm__ __volatile__ ("rdtsc" : "=a"(lo), "=d"(hi));
+    return uint64_t(lo) | (uint64_t(hi) << 32);
+#else
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+  }
+
+  /**
+   * @param queue_sample_interval Sample the event queue size every this many events
+   */
+  explicit EventProfiler(uint64_t queue_sample_interval);
+
+  /**
+   * Name the links with ids in [first, end), e.g. the switch-to-switch links.
+   * Links outside every class are the self links of components.
+   */
+  void addLinkClass(uint64_t first, uint64_t end, const std::string& name);
+
+  void recordHandler(EventHandler* handler, uint32_t link_id, uint64_t num_events, uint64_t cycles){
+    auto iter = handlers_.find(handler);
+    if (iter == handlers_.end()){
+      iter = addHandler(handler);
+    }
+    iter->second.events += num_events;
+    iter->second.cycles += cycles;
+    Entry& link = linkClass(link_id);
+    link.events += num_events;
+    link.cycles += cycles;
+  }
+
+  void recordExecution(ExecutionEvent* ev, uint64_t cycles);
+
+  void recordQueue(Timestamp now, uint64_t size){
+    if (++since_sample_ >= queue_sample_interval_){
+      since_sample_ = 0;
+      queue_samples_.push_back({now.sec(), size});
+    }
+    max_queue_ = std::max(max_queue_, size);
+  }
+
+  void addCrossThread(uint64_t n){
+    cross_thread_events_ += n;
+  }
+
+  void addIpc(uint64_t n){
+    ipc_events_ += n;
+  }
+
+  /**
+   * Fold the counters of another thread into this profile
+   */
+  void merge(const EventProfiler& other);
+
+  /**
+   * Print the busiest handler types, components and event origins, hottest first
+   */
+  void report(std::ostream& os, int max_rows) const;
+
+  /**
+   * Write every component and link class as a CSV table or, if the file ends in .json,
+   * the full profile including queue samples as JSON
+   */
+  void writeFile(const std::string& fname) const;
+
+ private:
+  using HandlerMap = std::unordered_map<EventHandler*, Entry>;
+
+  HandlerMap::iterator addHandler(EventHandler* handler);
+
+  Entry& linkClass(uint32_t link_id);
+
+  /** Sum entries that share a key, sorted by cycles */
+  std::vector<Entry> aggregate(bool by_type) const;
+
+  /** The link classes that saw events, sorted by cycles */
+  std::vector<Entry> linkClasses() const;
+
+  HandlerMap handlers_;
+  std::unordered_map<std::type_index, Entry> executions_;
+
+  /** The first link id of each class, mapped to one past its last id and its index */
+  std::map<uint64_t, std::pair<uint64_t,int>> link_ranges_;
+  /** One entry per link class, the first one counts the self links */
+  std::vector<Entry> link_classes_;
+
+  std::vector<QueueSample> queue_samples_;
+  uint64_t queue_sample_interval_;
+  uint64_t since_sample_;
+  uint64_t max_queue_;
+
+  uint64_t cross_thread_events_;
+  uint64_t ipc_events_;
+};
+
+}
+
+#endif
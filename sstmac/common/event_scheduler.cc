@@ -50,7 +50,6 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/common/sstmac_env.h>
 #include <sstmac/hardware/node/node.h>
 #include <sstmac/common/ipc_event.h>
-#include <sstmac/common/handler_event_queue_entry.h>
 #include <sprockit/sim_parameters.h>
 #include <sprockit/util.h>
 #include <sprockit/output.h>
@@ -109,6 +108,18 @@ MacroBaseComponent::endSimulation()
 void
 MacroBaseComponent::sendExecutionEvent(Timestamp arrival, ExecutionEvent *ev)
 {
+  //a recycled event may still carry the handler of a link it was sent on
+  ev->setHandler(nullptr);
+  ev->setTime(arrival);
+  ev->setSeqnum(seqnum_++);
+  ev->setLink(selfLinkId_);
+  mgr_->schedule(ev);
+}
+
+void
+MacroBaseComponent::sendEvent(Timestamp arrival, Event* ev, EventHandler* handler)
+{
+  ev->setHandler(handler);
   ev->setTime(arrival);
   ev->setSeqnum(seqnum_++);
   ev->setLink(selfLinkId_);
@@ -179,18 +190,40 @@ SubComponent::setup()
 void
 LocalLink::deliver(Event *ev)
 {
-  handler_->handle(ev);
+  handler_->invoke(ev);
+}
+
+bool
+LocalLink::appendToBatch(Timestamp arrival, Event* ev)
+{
+  if (batchTail_ && arrival == batchTime_){
+    //same link and time means adjacent in the queue order, the event manager
+    //requeues the rest of the chain if a handler inserts an event in between
+    batchTail_->setBatchNext(ev);
+    batchTail_ = ev;
+    return true;
+  } else {
+    batchTail_ = ev;
+    batchTime_ = arrival;
+    return false;
+  }
 }
 
 void
 LocalLink::send(TimeDelta delay, Event *ev)
 {
   Timestamp arrival = mgr_->now() + delay + latency_;
-  ExecutionEvent* qev = new HandlerExecutionEvent(ev, handler_);
-  qev->setSeqnum(seqnum_++);
-  qev->setTime(arrival);
-  qev->setLink(linkId_);
-  mgr_->schedule(qev);
+  ev->setHandler(handler_);
+  ev->setSeqnum(seqnum_++);
+  ev->setTime(arrival);
+  ev->setLink(linkId_);
+  //an arrival at the current time might already be running, never chain onto it
+  if (arrival > mgr_->now()){
+    if (appendToBatch(arrival, ev)) return;
+  } else {
+    batchTail_ = nullptr;
+  }
+  mgr_->schedule(ev);
 }
 
 void
@@ -221,19 +254,26 @@ IpcLink::deliver(Event* /*ev*/){
 void
 MultithreadLink::send(TimeDelta delay, Event* ev)
 {
-  ExecutionEvent* qev = new HandlerExecutionEvent(ev, handler_);
   Timestamp arrival = mgr_->now() + delay + latency_;
   mgr_->setMinIpcTime(arrival);
-  qev->setTime(arrival);
-  qev->setSeqnum(seqnum_++);
-  qev->setLink(linkId_);
-  dst_mgr_->multithreadSchedule(mgr_->pendingSlot(), mgr_->thread(), qev);
+  ev->setHandler(handler_);
+  ev->setTime(arrival);
+  ev->setSeqnum(seqnum_++);
+  ev->setLink(linkId_);
+  //the destination thread only reads our pending events at the next epoch,
+  //so chaining is safe as long as the head was posted during this epoch
+  if (batchEpoch_ != mgr_->pendingEpoch()){
+    batchEpoch_ = mgr_->pendingEpoch();
+    batchTail_ = nullptr;
+  }
+  if (appendToBatch(arrival, ev)) return;
+  dst_mgr_->multithreadSchedule(mgr_->pendingSlot(), mgr_->thread(), ev);
 }
 
 void
 MultithreadLink::deliver(Event* ev)
 {
-  handler_->handle(ev);
+  handler_->invoke(ev);
 }
 #endif
 
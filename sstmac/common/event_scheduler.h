@@ -47,7 +47,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <sstmac/common/timestamp.h>
 #include <sstmac/common/event_handler.h>
-#include <sstmac/common/handler_event_queue_entry.h>
+#include <sstmac/common/sst_event.h>
 #include <sstmac/common/sst_event_fwd.h>
 #include <sstmac/common/sstmac_config.h>
 #include <sstmac/common/stats/stat_collector.h>
@@ -373,6 +373,11 @@ class MacroBaseComponent
 
   void sendExecutionEvent(Timestamp arrival, ExecutionEvent* ev);
 
+  /**
+   * Schedule an event to be delivered to a handler on this component's self link
+   */
+  void sendEvent(Timestamp arrival, Event* ev, EventHandler* handler);
+
   void endSimulation();
 
   template <class T, class... Args> T* loadSub(const std::string& name, const std::string& /*iface*/, int slot_id,
@@ -509,6 +514,11 @@ template <class T, class Fxn>
 SST::Event::HandlerBase* newLinkHandler(const T* t, Fxn fxn){
   return new SST::Event::Handler<T>(const_cast<T*>(t), fxn);
 }
+
+template <class T, void (T::*Fxn)(Event*)>
+SST::Event::HandlerBase* newLinkHandler(const T* t){
+  return new SST::Event::Handler<T>(const_cast<T*>(t), Fxn);
+}
 #else
 template <class T, class Fxn, class... Args>
 SST::Event::HandlerBase* newLinkHandler(const T* t, Fxn fxn, Args&&... args){
@@ -516,12 +526,23 @@ SST::Event::HandlerBase* newLinkHandler(const T* t, Fxn fxn, Args&&... args){
         const_cast<T*>(t), fxn, std::forward<Args>(args)...);
 }
 
+/**
+ * Build a handler for a link with the receiving member function bound at compile time,
+ * e.g. newLinkHandler<MyNIC, &MyNIC::handlePayload>(this).
+ * Prefer this over the runtime member-function-pointer form on packet paths.
+ */
+template <class T, void (T::*Fxn)(Event*)>
+SST::Event::HandlerBase* newLinkHandler(const T* t){
+  return new BoundLinkHandler<T, Fxn>(const_cast<T*>(t));
+}
+
 class LocalLink : public EventLink {
  public:
   LocalLink(uint64_t linkId, TimeDelta latency, EventManager* mgr, EventHandler* hand) :
     EventLink(linkId, latency),
     handler_(hand),
-    mgr_(mgr)
+    mgr_(mgr),
+    batchTail_(nullptr)
   {
   }
 
@@ -538,8 +559,17 @@ class LocalLink : public EventLink {
   void send(TimeDelta delay, Event* ev) override;
 
  protected:
+  /**
+   * Chain the event onto the last event sent if both arrive at the same time
+   * @return Whether the event was chained and must not be scheduled
+   */
+  bool appendToBatch(Timestamp arrival, Event* ev);
+
   EventHandler* handler_;
   EventManager* mgr_;
+  /** The last event sent that is known to still be pending */
+  Event* batchTail_;
+  Timestamp batchTime_;
 
 };
 
@@ -549,7 +579,8 @@ class MultithreadLink : public LocalLink {
                   EventManager* src_mgr, EventManager* dst_mgr,
                   EventHandler* handler) :
     LocalLink(linkId, latency, src_mgr, handler),
-    dst_mgr_(dst_mgr)
+    dst_mgr_(dst_mgr),
+    batchEpoch_(0)
   {
     setMinThreadLatency(latency);
   }
@@ -560,6 +591,7 @@ class MultithreadLink : public LocalLink {
 
  private:
   EventManager* dst_mgr_;
+  uint64_t batchEpoch_;
 
 };
 
@@ -613,11 +645,11 @@ class SubLink : public EventLink
   }
 
   void deliver(Event* ev) override {
-    handler_->handle(ev);
+    handler_->invoke(ev);
   }
 
   void send(TimeDelta delay, Event *ev) override {
-    comp_->sendDelayedExecutionEvent(delay, new HandlerExecutionEvent(ev, handler_));
+    comp_->sendEvent(comp_->now() + delay, ev, handler_);
   }
 
  private:
@@ -50,6 +50,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/common/sstmac_config.h>
 #include <sstmac/common/event_scheduler_fwd.h>
 #include <sstmac/common/event_location.h>
+#include <sstmac/common/event_handler_fwd.h>
 #if SSTMAC_INTEGRATED_SST_CORE
 #include <sst/core/event.h>
 #endif
@@ -57,29 +58,16 @@ Questions? Contact sst-macro-help@sandia.gov
 namespace sstmac {
 
 
-#if SSTMAC_INTEGRATED_SST_CORE
-using Event = SST::Event;
-#else
-class Event : public serializable
-{
- public:
-  void serialize_order(serializer&) override{}
-  virtual std::string toString() const { return ""; }
-};
-#endif
-
-class ExecutionEvent : public Event
+/**
+ * The fields the event manager needs to order and dispatch an event.
+ * These are embedded directly in every event so that scheduling an event
+ * on a link does not need a separately allocated wrapper.
+ */
+class ScheduledEventHeader
 {
-  NotSerializable(ExecutionEvent)
  public:
-  ~ExecutionEvent() override {}
-
-#if SSTMAC_INTEGRATED_SST_CORE
-  virtual void execute() override = 0;
-#else
-  virtual void execute() = 0;
-#endif
-  ExecutionEvent() :
+  ScheduledEventHeader() :
+    handler_(nullptr),
     linkId_(-1),
     seqnum_(-1)
   {
@@ -109,14 +97,76 @@ class ExecutionEvent : public Event
     return linkId_;
   }
 
+  /**
+   * @return The handler the event is delivered to, null for an ExecutionEvent
+   */
+  EventHandler* handler() const {
+    return handler_;
+  }
+
+  void setHandler(EventHandler* handler){
+    handler_ = handler;
+  }
+
  protected:
   Timestamp time_;
+  EventHandler* handler_;
   uint32_t linkId_;
   /** A unique sequence number from the source */
   uint32_t seqnum_;
 
 };
 
+#if SSTMAC_INTEGRATED_SST_CORE
+using Event = SST::Event;
+#else
+/**
+ * An event can only be in flight on one link at a time -
+ * ownership passes to the receiving handler on delivery.
+ */
+class Event : public serializable, public ScheduledEventHeader
+{
+ public:
+  Event() : batchNext_(nullptr) {}
+
+  void serialize_order(serializer&) override{}
+  virtual std::string toString() const { return ""; }
+
+  /**
+   * Events that arrive on the same link at the same time can share one
+   * queue entry. The queued event heads a chain of the others in seqnum order.
+   * @return The next event in the same-time batch, null if none
+   */
+  Event* batchNext() const {
+    return batchNext_;
+  }
+
+  void setBatchNext(Event* ev){
+    batchNext_ = ev;
+  }
+
+ private:
+  Event* batchNext_;
+};
+#endif
+
+class ExecutionEvent :
+  public Event
+#if SSTMAC_INTEGRATED_SST_CORE
+  , public ScheduledEventHeader
+#endif
+{
+  NotSerializable(ExecutionEvent)
+ public:
+  ~ExecutionEvent() override {}
+
+#if SSTMAC_INTEGRATED_SST_CORE
+  virtual void execute() override = 0;
+#else
+  virtual void execute() = 0;
+#endif
+};
+
 using Callback = ExecutionEvent;
 
 
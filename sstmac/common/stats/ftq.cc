@@ -237,7 +237,7 @@ FTQOutput::startOutputGroup(StatisticGroup *grp)
 {
   active_group_ = grp->name;
 
-  std::string dat_fname = sprockit::sprintf("%s.csv", active_group_.c_str());
+  std::string dat_fname = sprockit::sprintf("%s.csv", grp->fileRoot().c_str());
   out_.open(dat_fname.c_str());
   includeHeaders_ = true;
 }
@@ -371,14 +371,16 @@ FTQOutput::dump(const std::vector<FTQCalendar*>& calendars, std::ostream& os,
   if (!compute_mean_ && name.empty()){
     TimeDelta stamp_sec(1.0);
     uint64_t ticks_s = stamp_sec.ticks();
-    std::cout << sprockit::sprintf("Aggregate time stats: %s\n", active_group_.c_str());
+    //groups may be written concurrently, print the summary in one piece
+    std::string summary = sprockit::sprintf("Aggregate time stats: %s\n", active_group_.c_str());
     for (int idx=0; idx < num_epoch_columns; ++idx){
       double num_s = event_totals[idx] / ticks_s;
       uint64_t remainder = event_totals[idx] - ticks_s*num_s;
       double rem_s = double(remainder) / double(ticks_s);
       double t_sec = num_s + rem_s;
-      std::cout << sprockit::sprintf("%16s: %16.5f s\n", keys[idx].c_str(), t_sec);
+      summary += sprockit::sprintf("%16s: %16.5f s\n", keys[idx].c_str(), t_sec);
     }
+    std::cout << summary;
   }
 }
 
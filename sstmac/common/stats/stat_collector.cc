@@ -96,7 +96,7 @@ void
 StatOutputCSV::startOutputGroup(StatisticGroup *grp)
 {
   if (!grp->columns.empty()){
-    std::string fname = grp->name + ".csv";
+    std::string fname = grp->fileRoot() + ".csv";
     csv_out_.open(fname);
     csv_out_ << "name,component";
     for (auto& pair : grp->columns){
@@ -105,6 +105,30 @@ StatOutputCSV::startOutputGroup(StatisticGroup *grp)
   }
 }
 
+void
+StatOutputCSV::mergePartial(std::string& into, const std::string& from,
+                            const std::string& group) const
+{
+  //every row is one statistic, partial files concatenate below a common header
+  if (into.empty()){
+    into = from;
+    return;
+  } else if (from.empty()){
+    return;
+  }
+  auto into_pos = into.find('\n');
+  auto from_pos = from.find('\n');
+  if (into.compare(0, into_pos, from, 0, from_pos) != 0){
+    spkt_abort_printf("statistics group %s has different columns on different threads:\n%s\n%s\n"
+                      "put statistics of different types in separate groups",
+                      group.c_str(), into.substr(0, into_pos).c_str(),
+                      from.substr(0, from_pos).c_str());
+  }
+  if (from_pos != std::string::npos){
+    into.append(from, from_pos, std::string::npos);
+  }
+}
+
 void
 StatOutputCSV::startOutputEntries(StatisticBase *stat)
 {
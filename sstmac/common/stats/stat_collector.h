@@ -139,6 +139,24 @@ class StatisticOutput
 
   virtual void output(StatisticBase* statistic, bool endOfSimFlag) = 0;
 
+  /**
+   * @return The suffix of the file a group is written to, e.g. ".csv", if the
+   *         partial files written by different threads or ranks can be merged.
+   *         Empty if each thread and rank keeps its own file.
+   */
+  virtual std::string mergeSuffix() const {
+    return std::string();
+  }
+
+  /**
+   * Merge the contents of one partial file of a group into another
+   * @param into  The merged contents, empty if nothing has been merged yet
+   * @param from  The contents of another partial file
+   * @param group The group name for error messages
+   */
+  virtual void mergePartial(std::string& /*into*/, const std::string& /*from*/,
+                            const std::string& /*group*/) const {}
+
 };
 
 struct StatisticGroup {
@@ -148,9 +166,22 @@ struct StatisticGroup {
   std::string name;
   std::map<std::string,int> ids;
   std::map<int,std::string> columns;
+  /** Tag of a per-thread partial output, empty if this group is the only writer */
+  std::string partition;
+  /** Prefix of the output files, e.g. to keep snapshot restarts apart */
+  std::string prefix;
   StatisticGroup(const std::string& n) :
     output(nullptr), name(n)
   {}
+
+  std::string fileRoot() const {
+    return mergedFileRoot() + partition;
+  }
+
+  /** The file root shared by all partial outputs, used for the merged file */
+  std::string mergedFileRoot() const {
+    return prefix + name;
+  }
 };
 
 class StatisticFieldsOutput : public StatisticOutput
@@ -255,6 +286,11 @@ class StatOutputCSV : public StatisticFieldsOutput {
   void endOfSimulation() override {}
   void printUsage() override {}
 
+  std::string mergeSuffix() const override { return ".csv"; }
+
+  void mergePartial(std::string& into, const std::string& from,
+                    const std::string& group) const override;
+
 
  private:
   template <class T> void output(fieldHandle_t handle, T&& data){
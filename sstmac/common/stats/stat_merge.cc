@@ -0,0 +1,152 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#include <sstmac/common/stats/stat_merge.h>
+#include <sprockit/factory.h>
+#include <sprockit/sim_parameters.h>
+#include <cstring>
+
+#if !SSTMAC_INTEGRATED_SST_CORE
+
+namespace sstmac {
+
+void
+treeMergeThreads(std::vector<PartialStatFiles>& lists, int max_threads)
+{
+  int max_parts = 0;
+  for (auto& list : lists){
+    max_parts = std::max<int>(max_parts, list.contents.size());
+  }
+  for (int stride=1; stride < max_parts; stride *= 2){
+    std::vector<std::pair<int,int>> merges;
+    for (int l=0; l < lists.size(); ++l){
+      for (int i=0; i + stride < lists[l].contents.size(); i += 2*stride){
+        merges.emplace_back(l, i);
+      }
+    }
+    parallelFor(merges.size(), max_threads, [&](int m){
+      PartialStatFiles& list = lists[merges[m].first];
+      int i = merges[m].second;
+      list.output->mergePartial(list.contents[i], list.contents[i+stride], list.group);
+      list.contents[i+stride].clear();
+      list.contents[i+stride].shrink_to_fit();
+    });
+  }
+}
+
+static void
+packString(std::string& buf, const std::string& str)
+{
+  uint64_t size = str.size();
+  buf.append((const char*) &size, sizeof(size));
+  buf.append(str);
+}
+
+static std::string
+unpackString(const std::string& buf, size_t& offset)
+{
+  uint64_t size;
+  ::memcpy(&size, buf.data() + offset, sizeof(size));
+  offset += sizeof(size);
+  std::string str = buf.substr(offset, size);
+  offset += size;
+  return str;
+}
+
+void
+packPartialStats(const PartialStatMap& stats, std::string& buf)
+{
+  for (auto& pair : stats){
+    packString(buf, pair.first);
+    packString(buf, pair.second.outputName);
+    packString(buf, pair.second.fileRoot);
+    packString(buf, pair.second.contents);
+  }
+}
+
+void
+unpackPartialStats(const std::string& buf, PartialStatMap& stats)
+{
+  size_t offset = 0;
+  while (offset < buf.size()){
+    std::string name = unpackString(buf, offset);
+    std::string output_name = unpackString(buf, offset);
+    std::string file_root = unpackString(buf, offset);
+    std::string contents = unpackString(buf, offset);
+    PartialStat& stat = stats[name];
+    if (!stat.output){
+      //this rank has no statistics in the group
+      SST::Params empty;
+      stat.output = sprockit::create<StatisticOutput>("macro", output_name, empty);
+      stat.owned = true;
+      stat.outputName = output_name;
+      stat.fileRoot = file_root;
+    }
+    stat.output->mergePartial(stat.contents, contents, name);
+  }
+}
+
+bool
+treeMergeRanks(int me, int nproc, PartialStatMap& stats,
+               const std::function<void(int, const std::string&)>& send,
+               const std::function<void(int, std::string&)>& recv)
+{
+  for (int stride=1; stride < nproc; stride *= 2){
+    if (me % (2*stride) == stride){
+      std::string buf;
+      packPartialStats(stats, buf);
+      send(me - stride, buf);
+      return false;
+    } else if (me + stride < nproc){
+      std::string buf;
+      recv(me + stride, buf);
+      unpackPartialStats(buf, stats);
+    }
+  }
+  return true;
+}
+
+}
+
+#endif
@@ -0,0 +1,151 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#ifndef SSTMAC_COMMON_STATS_STAT_MERGE_H_INCLUDED
+#define SSTMAC_COMMON_STATS_STAT_MERGE_H_INCLUDED
+
+#include <sstmac/common/stats/stat_collector.h>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !SSTMAC_INTEGRATED_SST_CORE
+
+namespace sstmac {
+
+/**
+ * Run fxn(i) for i in [0,n) on up to max_threads threads, including the caller
+ */
+template <class Fxn>
+void
+parallelFor(int n, int max_threads, Fxn&& fxn)
+{
+  std::atomic<int> next(0);
+  auto worker = [&]{
+    for (int i = next++; i < n; i = next++){
+      fxn(i);
+    }
+  };
+  std::vector<std::thread> workers;
+  int num_workers = std::min(n, max_threads);
+  for (int i=1; i < num_workers; ++i){
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto& thr : workers){
+    thr.join();
+  }
+}
+
+/**
+ * The partial files of one statistics group written by the threads of a rank
+ */
+struct PartialStatFiles {
+  const StatisticOutput* output;
+  std::string group;
+  /** The contents of each partial file, empty if a thread wrote nothing */
+  std::vector<std::string> contents;
+};
+
+/**
+ * Merge the partial files of every group in a binary tree. Each round merges
+ * disjoint pairs across all groups concurrently, the merged contents of a group
+ * end up in contents[0].
+ * @param lists        The partial files of each group
+ * @param max_threads  The number of threads merging at once
+ */
+void treeMergeThreads(std::vector<PartialStatFiles>& lists, int max_threads);
+
+/**
+ * The merged contents of the partial files of one statistics group
+ */
+struct PartialStat {
+  /** Merges contents, owned here if the group only exists on other ranks */
+  StatisticOutput* output;
+  bool owned;
+  std::string outputName;
+  /** The file name of the merged output without the suffix */
+  std::string fileRoot;
+  std::string contents;
+
+  PartialStat() : output(nullptr), owned(false) {}
+
+  PartialStat(const PartialStat&) = delete;
+
+  ~PartialStat(){
+    if (owned) delete output;
+  }
+};
+
+using PartialStatMap = std::map<std::string, PartialStat>;
+
+void packPartialStats(const PartialStatMap& stats, std::string& buf);
+
+/**
+ * Merge packed groups from another rank into stats, creating the output
+ * for any group this rank has no statistics in
+ */
+void unpackPartialStats(const std::string& buf, PartialStatMap& stats);
+
+/**
+ * Merge the groups of every rank in a binary tree, rank 0 ends up with everything
+ * @param me     This rank
+ * @param nproc  The number of ranks
+ * @param stats  The groups merged across the threads of this rank
+ * @param send   Send a packed buffer to a rank
+ * @param recv   Receive a packed buffer from a rank
+ * @return Whether this rank holds the merged groups and should write them
+ */
+bool treeMergeRanks(int me, int nproc, PartialStatMap& stats,
+                    const std::function<void(int, const std::string&)>& send,
+                    const std::function<void(int, std::string&)>& recv);
+
+}
+
+#endif
+
+#endif
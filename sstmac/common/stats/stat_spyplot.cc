@@ -50,10 +50,206 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sprockit/util.h>
 #include <algorithm>
 #include <list>
+#include <cstring>
+#include <iterator>
 
 namespace sstmac {
 
 SST_ELI_INSTANTIATE_MULTI_STATISTIC(StatSpyplot,int,uint64_t)
 
+#if !SSTMAC_INTEGRATED_SST_CORE
+static const char spyplot_csr_magic[] = "SPYCSR01";
+
+template <class T>
+static void
+packVector(std::string& buf, const std::vector<T>& vec)
+{
+  buf.append((const char*) vec.data(), vec.size() * sizeof(T));
+}
+
+template <class T>
+static void
+unpackVector(const std::string& buf, size_t& offset, uint64_t size, std::vector<T>& vec)
+{
+  if (offset + size * sizeof(T) > buf.size()){
+    spkt_abort_printf("truncated spyplot CSR file");
+  }
+  vec.resize(size);
+  ::memcpy(vec.data(), buf.data() + offset, size * sizeof(T));
+  offset += size * sizeof(T);
+}
+
+void
+SpyplotCSR::pack(std::string& buf) const
+{
+  buf.append(spyplot_csr_magic, 8);
+  uint64_t header[] = { nrows(), ncols, cols.size() };
+  buf.append((const char*) header, sizeof(header));
+  packVector(buf, rowPtr);
+  packVector(buf, cols);
+  packVector(buf, vals);
+}
+
+void
+SpyplotCSR::unpack(const std::string& buf)
+{
+  uint64_t header[3];
+  if (buf.size() < 8 + sizeof(header) || buf.compare(0, 8, spyplot_csr_magic) != 0){
+    spkt_abort_printf("invalid spyplot CSR file");
+  }
+  ::memcpy(header, buf.data() + 8, sizeof(header));
+  size_t offset = 8 + sizeof(header);
+  ncols = header[1];
+  unpackVector(buf, offset, header[0] + 1, rowPtr);
+  unpackVector(buf, offset, header[2], cols);
+  unpackVector(buf, offset, header[2], vals);
+}
+
+SpyplotCSR
+SpyplotCSR::merge(const SpyplotCSR& a, const SpyplotCSR& b)
+{
+  SpyplotCSR c;
+  c.ncols = std::max(a.ncols, b.ncols);
+  uint64_t nrows = std::max(a.nrows(), b.nrows());
+  c.rowPtr.resize(nrows + 1);
+  c.cols.reserve(a.cols.size() + b.cols.size());
+  c.vals.reserve(a.vals.size() + b.vals.size());
+  for (uint64_t r=0; r < nrows; ++r){
+    uint64_t ai = r < a.nrows() ? a.rowPtr[r] : 0;
+    uint64_t a_end = r < a.nrows() ? a.rowPtr[r+1] : 0;
+    uint64_t bi = r < b.nrows() ? b.rowPtr[r] : 0;
+    uint64_t b_end = r < b.nrows() ? b.rowPtr[r+1] : 0;
+    //both rows are sorted by column, merge them
+    while (ai < a_end || bi < b_end){
+      if (bi == b_end || (ai < a_end && a.cols[ai] < b.cols[bi])){
+        c.cols.push_back(a.cols[ai]);
+        c.vals.push_back(a.vals[ai++]);
+      } else if (ai == a_end || b.cols[bi] < a.cols[ai]){
+        c.cols.push_back(b.cols[bi]);
+        c.vals.push_back(b.vals[bi++]);
+      } else {
+        c.cols.push_back(a.cols[ai]);
+        c.vals.push_back(a.vals[ai++] + b.vals[bi++]);
+      }
+    }
+    c.rowPtr[r+1] = c.cols.size();
+  }
+  return c;
+}
+
+void
+StatSpyplotCSROutput::startOutputGroup(StatisticGroup *grp)
+{
+  fname_ = grp->fileRoot() + ".csr";
+  rows_.clear();
+}
+
+void
+StatSpyplotCSROutput::output(StatisticBase *statistic, bool  /*endOfSimFlag*/)
+{
+  auto* spy = dynamic_cast<StatSpyplot<int,uint64_t>*>(statistic);
+  if (!spy){
+    spkt_abort_printf("csr output can only be used with spyplot statistics, got %s",
+                      statistic->name().c_str());
+  }
+  rows_.push_back(spy);
+}
+
+/**
+ * Statistics are named per source, e.g. NIC.5 or app1.rank5,
+ * the trailing integer is the row of the matrix
+ */
+static uint64_t
+spyplotRow(StatisticBase* stat)
+{
+  const std::string& id = stat->getStatSubId();
+  auto pos = id.find_last_not_of("0123456789");
+  pos = pos == std::string::npos ? 0 : pos + 1;
+  if (pos == id.size()){
+    spkt_abort_printf("spyplot %s:%s does not end in a row number",
+                      stat->name().c_str(), id.c_str());
+  }
+  return std::stoull(id.substr(pos));
+}
+
+void
+StatSpyplotCSROutput::stopOutputGroup()
+{
+  std::vector<std::pair<uint64_t,StatSpyplot<int,uint64_t>*>> rows;
+  for (auto* spy : rows_){
+    rows.emplace_back(spyplotRow(spy), spy);
+  }
+  std::sort(rows.begin(), rows.end(),
+    [](const std::pair<uint64_t,StatSpyplot<int,uint64_t>*>& l,
+       const std::pair<uint64_t,StatSpyplot<int,uint64_t>*>& r){
+    return l.first < r.first;
+  });
+
+  SpyplotCSR csr;
+  uint64_t nrows = rows.empty() ? 0 : rows.back().first + 1;
+  csr.rowPtr.assign(nrows + 1, 0);
+  std::vector<std::pair<int,uint64_t>> entries;
+  std::vector<std::pair<int,uint64_t>> more;
+  std::vector<std::pair<int,uint64_t>> sum;
+  uint64_t next_row = 0;
+  size_t i = 0;
+  while (i < rows.size()){
+    uint64_t row = rows[i].first;
+    rows[i].second->sortedRow(entries);
+    csr.ncols = std::max<uint64_t>(csr.ncols, rows[i].second->numCols());
+    //statistics sharing a row, e.g. the same rank of different apps, are summed
+    for (++i; i < rows.size() && rows[i].first == row; ++i){
+      rows[i].second->sortedRow(more);
+      csr.ncols = std::max<uint64_t>(csr.ncols, rows[i].second->numCols());
+      sum.clear();
+      std::merge(entries.begin(), entries.end(), more.begin(), more.end(),
+                 std::back_inserter(sum));
+      entries.clear();
+      for (auto& entry : sum){
+        if (!entries.empty() && entries.back().first == entry.first){
+          entries.back().second += entry.second;
+        } else {
+          entries.push_back(entry);
+        }
+      }
+    }
+    //rows with no statistic are empty
+    for (; next_row < row; ++next_row){
+      csr.rowPtr[next_row+1] = csr.cols.size();
+    }
+    for (auto& entry : entries){
+      csr.cols.push_back(entry.first);
+      csr.vals.push_back(entry.second);
+      csr.ncols = std::max<uint64_t>(csr.ncols, entry.first + 1);
+    }
+    csr.rowPtr[row+1] = csr.cols.size();
+    next_row = row + 1;
+  }
+
+  std::string buf;
+  csr.pack(buf);
+  std::ofstream out(fname_, std::ios::binary);
+  out << buf;
+  rows_.clear();
+}
+
+void
+StatSpyplotCSROutput::mergePartial(std::string& into, const std::string& from,
+                                   const std::string&  /*group*/) const
+{
+  if (into.empty()){
+    into = from;
+    return;
+  } else if (from.empty()){
+    return;
+  }
+  SpyplotCSR a, b;
+  a.unpack(into);
+  b.unpack(from);
+  into.clear();
+  SpyplotCSR::merge(a, b).pack(into);
+}
+#endif
+
 
 } //end namespace
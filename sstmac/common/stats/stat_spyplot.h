@@ -53,6 +53,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <fstream>
 #include <map>
 #include <unordered_map>
+#include <algorithm>
 
 namespace sstmac {
 
@@ -60,6 +61,8 @@ namespace sstmac {
 
 /**
  * this stat_collector class keeps a spy plot
+ * each statistic is one row (source) of the traffic matrix,
+ * only destinations that were actually sent to are stored
  */
 template <class Dst, class Count>
 class StatSpyplot : public SST::Statistics::MultiStatistic<Dst,Count>
@@ -78,9 +81,7 @@ class StatSpyplot : public SST::Statistics::MultiStatistic<Dst,Count>
               const std::string& statName, SST::Params& params)
     : SST::Statistics::MultiStatistic<Dst,Count>(comp, name, statName, params)
   {
-    n_dst_ = params.find<Dst>("ncols");
-    vals_.resize(n_dst_);
-    fields_.resize(n_dst_);
+    n_dst_ = params.find<Dst>("ncols", 0);
   }
 
   ~StatSpyplot() override {}
@@ -89,7 +90,25 @@ class StatSpyplot : public SST::Statistics::MultiStatistic<Dst,Count>
     vals_[dest] += num;
   }
 
+  Dst numCols() const {
+    return n_dst_;
+  }
+
+  /**
+   * @param row [out] The nonzero entries of this row sorted by destination
+   */
+  void sortedRow(std::vector<std::pair<Dst,Count>>& row) const {
+    row.assign(vals_.begin(), vals_.end());
+    std::sort(row.begin(), row.end());
+  }
+
   void registerOutputFields(SST::Statistics::StatisticFieldsOutput* output) override {
+    //field outputs need a dense row, use csr output for large matrices
+    if (n_dst_ == 0){
+      spkt_abort_printf("spyplot %s needs ncols for field outputs like csv",
+                        this->getStatName().c_str());
+    }
+    fields_.resize(n_dst_);
     for (int i=0; i < n_dst_; ++i){
       auto str = sprockit::sprintf("spy%d", i);
       fields_[i] = output->registerField<uint64_t>(str.c_str());
@@ -98,17 +117,92 @@ class StatSpyplot : public SST::Statistics::MultiStatistic<Dst,Count>
 
   void outputStatisticFields(SST::Statistics::StatisticFieldsOutput* output, bool  /*endOfSim*/) override {
     for (int i=0; i < n_dst_; ++i){
-      output->outputField(fields_[i], vals_[i]);
+      auto iter = vals_.find(i);
+      Count val = iter == vals_.end() ? Count() : iter->second;
+      output->outputField(fields_[i], val);
     }
   }
 
  protected:
-  std::vector<Count> vals_;
+  std::unordered_map<Dst,Count> vals_;
   Dst n_dst_;
   std::vector<SST::Statistics::StatisticOutput::fieldHandle_t> fields_;
 
 };
 
+#if !SSTMAC_INTEGRATED_SST_CORE
+/**
+ * A traffic matrix in compressed sparse row format.
+ * The binary file is, all integers little-endian:
+ *   char[8] "SPYCSR01"
+ *   uint64  nrows, ncols, nnz
+ *   uint64  row_ptr[nrows+1]
+ *   uint32  cols[nnz]
+ *   uint64  vals[nnz]
+ */
+struct SpyplotCSR {
+  uint64_t ncols;
+  std::vector<uint64_t> rowPtr;
+  std::vector<uint32_t> cols;
+  std::vector<uint64_t> vals;
+
+  SpyplotCSR() : ncols(0), rowPtr(1, 0) {}
+
+  uint64_t nrows() const {
+    return rowPtr.size() - 1;
+  }
+
+  void pack(std::string& buf) const;
+
+  void unpack(const std::string& buf);
+
+  /**
+   * Sum two matrices row by row without expanding either
+   */
+  static SpyplotCSR merge(const SpyplotCSR& a, const SpyplotCSR& b);
+};
+
+class StatSpyplotCSROutput : public sstmac::StatisticOutput
+{
+ public:
+  SST_ELI_REGISTER_DERIVED(
+    SST::Statistics::StatisticOutput,
+    StatSpyplotCSROutput,
+    "macro",
+    "csr",
+    SST_ELI_ELEMENT_VERSION(1,0,0),
+    "Writes spyplots as a binary compressed sparse row matrix")
+
+  StatSpyplotCSROutput(SST::Params& params) :
+    sstmac::StatisticOutput(params)
+  {
+  }
+
+  ~StatSpyplotCSROutput() override{}
+
+  void registerStatistic(SST::Statistics::StatisticBase*) override {}
+
+  void startOutputGroup(SST::Statistics::StatisticGroup * grp) override;
+  void stopOutputGroup() override;
+
+  void output(SST::Statistics::StatisticBase* statistic, bool endOfSimFlag) override;
+
+  std::string mergeSuffix() const override { return ".csr"; }
+
+  void mergePartial(std::string& into, const std::string& from,
+                    const std::string& group) const override;
+
+  bool checkOutputParameters() override { return true; }
+  void startOfSimulation() override {}
+  void endOfSimulation() override {}
+  void printUsage() override {}
+
+ private:
+  std::string fname_;
+  std::vector<StatSpyplot<int,uint64_t>*> rows_;
+
+};
+#endif
 
 }
 
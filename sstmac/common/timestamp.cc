@@ -89,19 +89,20 @@ void TimeDelta::initStamps(tick_t tick_spacing)
   std::stringstream ss;
   ss << tick_spacing << " as";
   _tick_spacing_string_ = ss.str();
-  one_femtosecond = 1000/ASEC_PER_TICK;
-  one_picosecond = 1000*one_femtosecond;
-  one_nanosecond = 1000 * one_picosecond;
-  one_microsecond = 1000 * one_nanosecond;
-  one_millisecond = 1000 * one_microsecond;
-  one_second = 1000 * one_millisecond;
+  //units finer than a tick have no whole number of ticks and are left at zero
+  one_femtosecond = 1000ULL/ASEC_PER_TICK;
+  one_picosecond = 1000000ULL/ASEC_PER_TICK;
+  one_nanosecond = 1000000000ULL/ASEC_PER_TICK;
+  one_microsecond = 1000000000000ULL/ASEC_PER_TICK;
+  one_millisecond = 1000000000000000ULL/ASEC_PER_TICK;
+  one_second = 1000000000000000000ULL/ASEC_PER_TICK;
   one_minute = 60 * one_second;
-  s_per_tick = 1.0/one_second;
-  ms_per_tick = 1.0/one_millisecond;
-  us_per_tick = 1.0/one_microsecond;
-  ns_per_tick = 1.0/one_nanosecond;
-  ps_per_tick = 1.0/one_picosecond;
-  fs_per_tick = 1.0/one_femtosecond;
+  s_per_tick = ASEC_PER_TICK / 1e18;
+  ms_per_tick = ASEC_PER_TICK / 1e15;
+  us_per_tick = ASEC_PER_TICK / 1e12;
+  ns_per_tick = ASEC_PER_TICK / 1e9;
+  ps_per_tick = ASEC_PER_TICK / 1e6;
+  fs_per_tick = ASEC_PER_TICK / 1e3;
   max_time_ = std::numeric_limits<tick_t>::max() / one_second;
 }
 
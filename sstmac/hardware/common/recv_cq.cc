@@ -52,6 +52,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/hardware/common/packet.h>
 #include <sstmac/hardware/common/recv_cq.h>
 #include <sstmac/hardware/common/flow.h>
+#include <sstmac/common/stats/stat_collector.h>
 #include <sprockit/output.h>
 
 namespace sstmac {
@@ -59,13 +60,97 @@ namespace hw {
 
 #define DEBUG_CQ 0
 
+RecvCQ::RecvCQ() :
+  size_(0),
+  active_flows_(nullptr)
+{
+  rehash(min_capacity);
+}
+
+void
+RecvCQ::rehash(uint32_t capacity)
+{
+  std::vector<incomingMsg> old(capacity);
+  old.swap(slots_);
+  mask_ = capacity - 1;
+  shift_ = 64;
+  while (capacity > 1){
+    capacity >>= 1;
+    --shift_;
+  }
+  for (incomingMsg& incoming : old){
+    if (incoming.used){
+      uint32_t idx = slot(incoming.id);
+      while (slots_[idx].used){
+        idx = (idx + 1) & mask_;
+      }
+      slots_[idx] = incoming;
+    }
+  }
+}
+
+RecvCQ::incomingMsg&
+RecvCQ::findOrInsert(uint64_t unique_id)
+{
+  uint32_t idx = slot(unique_id);
+  while (slots_[idx].used){
+    if (slots_[idx].id == unique_id){
+      return slots_[idx];
+    }
+    idx = (idx + 1) & mask_;
+  }
+
+  //keep the load factor at or below 1/2
+  if (2*(size_ + 1) > slots_.size()){
+    rehash(2*slots_.size());
+    idx = slot(unique_id);
+    while (slots_[idx].used){
+      idx = (idx + 1) & mask_;
+    }
+  }
+
+  ++size_;
+  if (active_flows_){
+    active_flows_->addData(size_);
+  }
+
+  incomingMsg& incoming = slots_[idx];
+  incoming.used = true;
+  incoming.id = unique_id;
+  return incoming;
+}
+
+void
+RecvCQ::erase(uint32_t idx)
+{
+  //backward-shift deletion: pull later entries of the probe chain
+  //into the hole unless that would move them before their home slot
+  uint32_t hole = idx;
+  uint32_t next = (hole + 1) & mask_;
+  while (slots_[next].used){
+    uint32_t home = slot(slots_[next].id);
+    bool stays = hole <= next ? (hole < home && home <= next) : (hole < home || home <= next);
+    if (!stays){
+      slots_[hole] = slots_[next];
+      hole = next;
+    }
+    next = (next + 1) & mask_;
+  }
+  slots_[hole] = incomingMsg();
+  --size_;
+
+  if (slots_.size() > min_capacity && 8*size_ < slots_.size()){
+    rehash(slots_.size() / 2);
+  }
+}
+
 void
 RecvCQ::print()
 {
   coutn << "Completion Queue" << std::endl;
-  for (auto& pair : bytes_recved_){
-    incomingMsg& incoming = pair.second;
-    coutn << "Message " << pair.first << " has "
+  for (incomingMsg& incoming : slots_){
+    if (!incoming.used) continue;
+    coutn << "Message " << incoming.id << " has "
         << incoming.bytes_arrived << " bytes arrived "
         << " out of " << incoming.bytes_total << "\n";
   }
@@ -74,7 +159,7 @@ RecvCQ::print()
 Flow*
 RecvCQ::recv(uint64_t unique_id, uint32_t bytes, Flow* orig)
 {
-  incomingMsg& incoming  = bytes_recved_[unique_id];
+  incomingMsg& incoming = findOrInsert(unique_id);
 #if SSTMAC_SANITY_CHECK
   if (incoming.msg && orig){
     spkt_abort_printf(
@@ -91,7 +176,7 @@ RecvCQ::recv(uint64_t unique_id, uint32_t bytes, Flow* orig)
 
   if (incoming.bytes_arrived == incoming.bytes_total){
     Flow* ret = incoming.msg;
-    bytes_recved_.erase(unique_id);
+    erase(&incoming - slots_.data());
     return ret;
   } else {
     return NULL;
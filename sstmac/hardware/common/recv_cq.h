@@ -45,9 +45,9 @@ Questions? Contact sst-macro-help@sandia.gov
 #ifndef NIC_RECV_CQ_H
 #define NIC_RECV_CQ_H
 
-#include <unordered_map>
+#include <vector>
 #include <sstmac/hardware/common/packet.h>
-#include <sprockit/allocator.h>
+#include <sstmac/common/stats/stat_collector_fwd.h>
 
 namespace sstmac {
 namespace hw {
@@ -60,12 +60,17 @@ because a packet can be marked as the "tail" and used to track when an entire me
 When using adaptive or multipath routing, messages arrive out-of-order.
 This class tracks whether all packets have been received and signals to some handler
 that an entire message has fully arrived.
+Partially received flows are kept in an open-addressed (linear probing) table
+with inline storage. Completed flows are removed by backward-shift deletion
+so no tombstones accumulate, and the table grows/shrinks with the number of active flows.
 @class nic_RecvCQ
 */
 class RecvCQ
 {
 
  public:
+  RecvCQ();
+
   /**
       Log packet and determine if parent message has fully arrived
       @param packet The arriving packet
@@ -77,27 +82,55 @@ class RecvCQ
 
   void print();
 
+  /**
+   * @return The number of flows currently being reassembled
+   */
+  uint32_t numActive() const {
+    return size_;
+  }
+
+  /**
+   * @param stat Statistic that receives the number of active flows every time a new flow starts
+   */
+  void setActiveFlowStat(Statistic<uint64_t>* stat){
+    active_flows_ = stat;
+  }
+
  protected:
   struct incomingMsg {
+    uint64_t id;
     Flow* msg;
     uint64_t bytes_arrived;
     uint64_t bytes_total;
+    bool used;
     incomingMsg() :
+        id(0),
         msg(0),
         bytes_arrived(0),
-        bytes_total(0)
+        bytes_total(0),
+        used(false)
     {
     }
   };
 
-  /**
-      Keys are unique network ID for all messages.
-      Value is the number of bytes receved.
-  */
-  using pair_type = std::pair<const uint64_t, incomingMsg>;
-  using alloc = sprockit::threadSafeAllocator<pair_type>;
-  using received_map = std::map<uint64_t, incomingMsg, std::less<uint64_t>, alloc>;
-  received_map bytes_recved_;
+  static constexpr uint32_t min_capacity = 16;
+
+  uint32_t slot(uint64_t unique_id) const {
+    //Fibonacci hashing - flow ids are often sequential
+    return uint32_t((unique_id * 0x9E3779B97F4A7C15ull) >> shift_);
+  }
+
+  incomingMsg& findOrInsert(uint64_t unique_id);
+
+  void erase(uint32_t idx);
+
+  void rehash(uint32_t capacity);
+
+  std::vector<incomingMsg> slots_;
+  uint32_t mask_;
+  int shift_;
+  uint32_t size_;
+  Statistic<uint64_t>* active_flows_;
 };
 
 }
@@ -162,10 +162,15 @@ Interconnect::Interconnect(SST::Params& params, SSTMAC_MAYBE_UNUSED EventManager
   buildEndpoints(node_params, nic_params, mgr);
 
   uint64_t linkId = connectLogP(0/*number from zero*/, mgr, node_params, nic_params);
+  mgr->addLinkClass(0, linkId, "logp");
   if (!logp_model){
     buildSwitches(switch_params, mgr);
+    uint64_t firstLinkId = linkId;
     linkId = connectSwitches(linkId, mgr, switch_params);
+    mgr->addLinkClass(firstLinkId, linkId, "switch-switch");
+    firstLinkId = linkId;
     linkId = connectEndpoints(linkId, mgr, nic_params, switch_params);
+    mgr->addLinkClass(firstLinkId, linkId, "switch-endpoint");
     configureInterconnectLookahead(params);
   } else {
     //lookahead is actually higher
@@ -45,9 +45,11 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/hardware/memory/memory_model.h>
 #include <sstmac/hardware/node/node.h>
 #include <sstmac/common/event_manager.h>
+#include <sstmac/common/event_callback.h>
 #include <sprockit/statics.h>
 #include <sprockit/sim_parameters.h>
 #include <sprockit/util.h>
+#include <algorithm>
 
 RegisterDebugSlot(memory, "debug info related to memory accesses");
 
@@ -57,8 +59,12 @@ namespace hw {
 static sprockit::NeedDeletestatics<MemoryModel> need_del;
 
 MemoryModel::MemoryModel(uint32_t id, SST::Params& /*params*/, Node* node) :
-  SubComponent(id, "mem", node)
+  SubComponent(id, "mem", node),
+  flows_active_(0),
+  flows_started_(0),
+  replay_id_(0)
 {
+  replay_.cb = nullptr;
   parent_node_ = node;
   nodeid_ = parent_node_->addr();
 }
@@ -68,6 +74,65 @@ MemoryModel::addr() const {
   return parent_node_->addr();
 }
 
+void
+MemoryModel::startFlow(uint64_t bytes, TimeDelta byte_request_delay, Callback* cb)
+{
+  if (replay_.cb) materializeReplay();
+  ++flows_active_;
+  ++flows_started_;
+  accessFlow(bytes, byte_request_delay, newCallback(this, &MemoryModel::flowDone, cb));
+}
+
+void
+MemoryModel::flowDone(Callback* cb)
+{
+  --flows_active_;
+  cb->execute();
+  delete cb;
+}
+
+void
+MemoryModel::replayFlow(uint64_t bytes, TimeDelta byte_request_delay, TimeDelta duration, Callback* cb)
+{
+  if (replay_.cb) materializeReplay();
+  ++flows_active_;
+  ++flows_started_;
+  replay_.bytes = bytes;
+  replay_.byte_request_delay = byte_request_delay;
+  replay_.duration = duration;
+  replay_.end = now() + duration;
+  replay_.cb = cb;
+  sendDelayedExecutionEvent(duration, newCallback(this, &MemoryModel::replayDone, ++replay_id_));
+}
+
+void
+MemoryModel::replayDone(uint64_t replay_id)
+{
+  //the flow was handed to the memory model, or a later replay replaced it
+  if (replay_id != replay_id_ || !replay_.cb) return;
+
+  --flows_active_;
+  Callback* cb = replay_.cb;
+  replay_.cb = nullptr;
+  cb->execute();
+  delete cb;
+}
+
+void
+MemoryModel::materializeReplay()
+{
+  //finishing now anyway, let replayDone complete it
+  if (replay_.end <= now()) return;
+
+  TimeDelta remaining = replay_.end - now();
+  double frac = remaining.sec() / replay_.duration.sec();
+  uint64_t bytes_left = std::max(uint64_t(1), uint64_t(replay_.bytes * frac + 0.5));
+  Callback* cb = replay_.cb;
+  replay_.cb = nullptr;
+  //still counted in flows_active_, flowDone releases it
+  accessFlow(bytes_left, replay_.byte_request_delay, newCallback(this, &MemoryModel::flowDone, cb));
+}
+
 int
 MemoryModel::initialize(RequestHandlerBase* handler)
 {
@@ -116,6 +116,39 @@ class MemoryModel : public SubComponent
    */
   virtual void accessFlow(uint64_t bytes, TimeDelta byte_request_delay, Callback* cb) = 0;
 
+  /**
+   * @brief startFlow Begin a flow through accessFlow, keeping count of the flows in flight
+   * @param bytes
+   * @param byte_request_delay How long it takes for a memory read/write instruction to be issued
+   * @param cb
+   */
+  void startFlow(uint64_t bytes, TimeDelta byte_request_delay, Callback* cb);
+
+  /**
+   * @brief replayFlow Stand in for a flow whose uncontended duration is already known.
+   * The flow counts as active until it completes. If another flow starts first,
+   * the bytes not yet transferred are handed to accessFlow so the two contend.
+   * @param bytes
+   * @param byte_request_delay How long it takes for a memory read/write instruction to be issued
+   * @param duration How long the flow takes when nothing else uses the memory system
+   * @param cb
+   */
+  void replayFlow(uint64_t bytes, TimeDelta byte_request_delay, TimeDelta duration, Callback* cb);
+
+  /**
+   * @return The number of flows started but not yet completed
+   */
+  int flowsActive() const {
+    return flows_active_;
+  }
+
+  /**
+   * @return The number of flows ever started, a change means a new flow has begun
+   */
+  uint64_t flowsStarted() const {
+    return flows_started_;
+  }
+
   /**
    * @brief access Call for individal requests
    * @param linkId
@@ -132,6 +165,28 @@ class MemoryModel : public SubComponent
   Node* parent_node_;
   std::vector<RequestHandlerBase*> rsp_handlers_;
 
+ private:
+  void flowDone(Callback* cb);
+
+  void replayDone(uint64_t replay_id);
+
+  /** Turn the unfinished part of the replayed flow into a real flow */
+  void materializeReplay();
+
+  struct ReplayedFlow {
+    uint64_t bytes;
+    TimeDelta byte_request_delay;
+    TimeDelta duration;
+    Timestamp end;
+    /** Null if no replayed flow is in progress */
+    Callback* cb;
+  };
+
+  int flows_active_;
+  uint64_t flows_started_;
+  ReplayedFlow replay_;
+  uint64_t replay_id_;
+
 };
 
 class NullMemoryModel : public MemoryModel
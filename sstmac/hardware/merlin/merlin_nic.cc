@@ -121,6 +121,7 @@ class MerlinNIC :
     vns_(2),
     test_size_(0)
   {
+    cq_.setActiveFlowStat(recv_flows_);
     int slot_id = 0;
     /** All bandwidth and other parameters get pulled in
         through params now, not through initialize */
@@ -96,6 +96,7 @@ NIC::NIC(uint32_t id, SST::Params& params, Node* parent) :
   parent_(parent), 
   my_addr_(parent->addr()),
   logp_link_(nullptr),
+  recv_flows_(nullptr),
   spy_bytes_(nullptr),
   xmit_flows_(nullptr),
   queue_(parent->os()),
@@ -112,6 +113,7 @@ NIC::NIC(uint32_t id, SST::Params& params, Node* parent) :
   spy_bytes_ = dynamic_cast<StatSpyplot<int,uint64_t>*>(spy);
 
   xmit_flows_ = registerStatistic<uint64_t>(params, "xmit_flows", subname);
+  recv_flows_ = registerStatistic<uint64_t>(params, "recv_flows", subname);
 }
 
 void
@@ -146,7 +148,7 @@ NIC::~NIC()
 EventHandler*
 NIC::mtlHandler() const
 {
-  return newHandler(const_cast<NIC*>(this), &NIC::mtlHandle);
+  return newLinkHandler<NIC, &NIC::mtlHandle>(this);
 }
 
 void
@@ -270,9 +272,9 @@ NIC::intranodeSend(NetworkMessage* payload)
   //use 64 as a negligible number of compute bytes
   uint64_t byte_length = payload->byteLength();
   if (byte_length > 64){
-    mem->accessFlow(payload->byteLength(),
-                TimeDelta(), //assume NIC can issue mem requests without delay
-                newCallback(this, &NIC::finishMemcpy, payload));
+    mem->startFlow(payload->byteLength(),
+                   TimeDelta(), //assume NIC can issue mem requests without delay
+                   newCallback(this, &NIC::finishMemcpy, payload));
   } else {
     finishMemcpy(payload);
   }
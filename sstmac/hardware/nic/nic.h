@@ -63,6 +63,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <sprockit/debug.h>
 #include <sprockit/factory.h>
+#include <sprockit/thread_safe_new.h>
 
 #include <functional>
 
@@ -216,6 +217,7 @@ protected:
   NodeId my_addr_;
   EventLink::ptr logp_link_;
   Topology* top_;
+  Statistic<uint64_t>* recv_flows_;
 
  private:
   StatSpyplot<int,uint64_t>* spy_bytes_;
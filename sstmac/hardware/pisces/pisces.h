@@ -47,7 +47,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <sstmac/hardware/common/packet.h>
 #include <sstmac/hardware/common/flow.h>
-#include <sprockit/thread_safe_new.h>
+#include <sprockit/object_pool.h>
 #include <sprockit/factory.h>
 #include <sprockit/debug.h>
 
@@ -66,7 +66,7 @@ namespace hw {
  */
 class PiscesPacket :
   public Packet,
-  public sprockit::thread_safe_new<PiscesPacket>
+  public sprockit::ObjectPool<PiscesPacket>
 {
  public:
   ImplementSerializable(PiscesPacket)
@@ -74,6 +74,9 @@ class PiscesPacket :
   static const double uninitialized_bw;
 
  public:
+  using sprockit::ObjectPool<PiscesPacket>::operator new;
+  using sprockit::ObjectPool<PiscesPacket>::operator delete;
+
   PiscesPacket(
     Flow* msg,
     uint32_t numBytes,
@@ -192,13 +195,16 @@ class PiscesPacket :
 class PiscesCredit :
   public Event,
   public sprockit::printable,
-  public sprockit::thread_safe_new<PiscesCredit>
+  public sprockit::ObjectPool<PiscesCredit>
 {
 
  public:
   ImplementSerializable(PiscesCredit)
 
  public:
+  using sprockit::ObjectPool<PiscesCredit>::operator new;
+  using sprockit::ObjectPool<PiscesCredit>::operator delete;
+
   PiscesCredit(){} //for serialization
 
   PiscesCredit(
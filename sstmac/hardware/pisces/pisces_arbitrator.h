@@ -46,6 +46,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #define PACKETFLOW_ARBITRATOR_H
 
 #include <sstmac/hardware/pisces/pisces.h>
+#include <sprockit/thread_safe_new.h>
 #include <sstmac/hardware/topology/topology_fwd.h>
 #include <sstmac/common/timestamp.h>
 #include <sprockit/factory.h>
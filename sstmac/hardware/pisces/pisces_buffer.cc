@@ -79,6 +79,7 @@ PiscesBuffer::setOutput(int  /*this_outport*/, int dst_inport, EventLink::ptr&&
     credits_[i] = num_credits_per_vc;
     initial_credits_[i] = num_credits_per_vc;
   }
+  busy_bytes_ = 0;
 }
 
 PiscesBuffer::PiscesBuffer(SST::Params& params, const std::string& selfname, uint32_t id,
@@ -90,6 +91,7 @@ PiscesBuffer::PiscesBuffer(SST::Params& params, const std::string& selfname, uin
     queues_(num_vc),
     credits_(num_vc, 0),
     initial_credits_(num_vc,0),
+    busy_bytes_(0),
     packet_size_(packet_size),
     xmit_wait_(nullptr),
     xmit_bytes_(nullptr)
@@ -128,6 +130,7 @@ PiscesBuffer::handleCredit(Event* ev)
 #endif
   int& num_credits = credits_[vc];
   num_credits += credit->numCredits();
+  busy_bytes_ -= credit->numCredits();
   //we've cleared out some of the delay
   bytes_delayed_ -= credit->numCredits();
 
@@ -155,6 +158,7 @@ PiscesBuffer::handleCredit(Event* ev)
   while (payload) {
     collectIdleTicks();
     num_credits -= payload->numBytes();
+    busy_bytes_ += payload->numBytes();
     //this actually doesn't create any new delay
     //this message was already queued so num_bytes
     //was already added to bytes_delayed
@@ -191,6 +195,7 @@ PiscesBuffer::handlePayload(Event* ev)
   bytes_delayed_ += pkt->numBytes();
   if (num_credits >= pkt->numBytes()) {
     num_credits -= pkt->numBytes();
+    busy_bytes_ += pkt->numBytes();
     xmit_bytes_->addData(pkt->byteLength());
     last_tail_left_ = send(arb_, pkt, input_, output_);
   } else {
@@ -213,6 +218,7 @@ PiscesBuffer::sendPayload(PiscesPacket *pkt)
   // either way there's a delay accumulating for other messages
   bytes_delayed_ += pkt->numBytes();
   num_credits -= pkt->numBytes();
+  busy_bytes_ += pkt->numBytes();
   xmit_bytes_->addData(pkt->byteLength());
   last_tail_left_ = send(arb_, pkt, input_, output_);
   return last_tail_left_;
@@ -224,12 +230,8 @@ PiscesBuffer::queueLength(int vc) const
   if (vc >= 0){
     int busyBytes = initial_credits_[vc] - credits_[vc];
     return busyBytes / packet_size_;
-  } else { //ah, okay, check all VCs
-    int busyBytes = 0;
-    for (int i=0; i < credits_.size(); ++i){
-      busyBytes += initial_credits_[i] - credits_[i];
-    }
-    return busyBytes / packet_size_;
+  } else { //ah, okay, all VCs
+    return totalQueueLength();
   }
 }
 
@@ -86,6 +86,13 @@ class PiscesBuffer :
 
   int queueLength(int vc) const;
 
+  /**
+   * @return The queue length summed over all VCs
+   */
+  int totalQueueLength() const {
+    return busy_bytes_ / packet_size_;
+  }
+
   PiscesBuffer(SST::Params& params, const std::string& selfname, uint32_t id,
                const std::string& arb, double bw, int packet_size,
                SST::Component* parent, int numVC);
@@ -99,6 +106,8 @@ class PiscesBuffer :
   std::vector<PayloadQueue> queues_;
   std::vector<int> credits_;
   std::vector<int> initial_credits_;
+  /** The credits in use summed over all VCs, kept in step with credits_ */
+  int busy_bytes_;
 
   PiscesBandwidthArbitrator* arb_;
   std::set<int> deadlocked_channels_;
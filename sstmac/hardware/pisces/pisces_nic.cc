@@ -66,8 +66,9 @@ PiscesNIC::PiscesNIC(uint32_t id, SST::Params& params, Node* parent) :
   NIC(id, params, parent),
   pending_inject_(1)
 {
+  completion_queue_.setActiveFlowStat(recv_flows_);
   SST::Params inj_params = params.get_scoped_params("injection");
-  self_mtl_link_ = allocateSubLink("mtl", TimeDelta(), newLinkHandler(this, &NIC::mtlHandle));
+  self_mtl_link_ = allocateSubLink("mtl", TimeDelta(), newLinkHandler<NIC, &NIC::mtlHandle>(this));
 
   inj_credits_ = inj_params.find<SST::UnitAlgebra>("credits").getRoundedValue();
   auto arb = inj_params.find<std::string>("arbitrator");
@@ -102,16 +103,16 @@ LinkHandler*
 PiscesNIC::payloadHandler(int port)
 {
   if (port == NIC::LogP){
-    return newLinkHandler(this, &NIC::mtlHandle);
+    return newLinkHandler<NIC, &NIC::mtlHandle>(this);
   } else {
-    return newLinkHandler(this, &PiscesNIC::incomingPacket);
+    return newLinkHandler<PiscesNIC, &PiscesNIC::incomingPacket>(this);
   }
 }
 
 LinkHandler*
 PiscesNIC::creditHandler(int  /*port*/)
 {
-  return newLinkHandler(this, &PiscesNIC::packetSent);
+  return newLinkHandler<PiscesNIC, &PiscesNIC::packetSent>(this);
 }
 
 void
@@ -169,7 +169,7 @@ PiscesSwitch::connectOutput(
   int buffer_inport = 0;
   std::string out_port_name = sprockit::sprintf("buffer-out%d", src_outport);
   auto out_link = allocateSubLink(out_port_name, TimeDelta(), //don't put latency on xbar
-                    newLinkHandler(out_buffer, &PiscesBuffer::handlePayload));
+                    newLinkHandler<PiscesBuffer, &PiscesBuffer::handlePayload>(out_buffer));
   xbar_->setOutput(src_outport, buffer_inport, std::move(out_link), link_credits_ * scale_factor);
 
   std::string in_port_name = sprockit::sprintf("xbar-credit%d", src_outport);
@@ -207,6 +207,22 @@ PiscesSwitch::queueLength(int port, int vc) const
   return buf->queueLength(vc);
 }
 
+int
+PiscesSwitch::portOccupancy(int port) const
+{
+  PiscesBuffer* buf = static_cast<PiscesBuffer*>(out_buffers_[port]);
+  return buf->totalQueueLength();
+}
+
+void
+PiscesSwitch::portOccupancies(const int* ports, int num_ports, int* occupancies) const
+{
+  for (int i=0; i < num_ports; ++i){
+    PiscesBuffer* buf = static_cast<PiscesBuffer*>(out_buffers_[ports[i]]);
+    occupancies[i] = buf->totalQueueLength();
+  }
+}
+
 std::string
 PiscesSwitch::toString() const
 {
@@ -231,14 +247,14 @@ PiscesSwitch::creditHandler(int port)
     spkt_abort_printf("Got invalid port %d request for credit handler - max is %d",
                       port, out_buffers_.size() - 1);
   }
-  return newLinkHandler(out_buffers_[port], &PiscesSender::handleCredit);
+  return newLinkHandler<PiscesSender, &PiscesSender::handleCredit>(out_buffers_[port]);
 }
 
 LinkHandler*
 PiscesSwitch::payloadHandler(int port)
 {
   InputPort* inp = &inports_[port];
-  return newLinkHandler(inp, &InputPort::handle);
+  return newLinkHandler<InputPort, &InputPort::handle>(inp);
 }
 
 }
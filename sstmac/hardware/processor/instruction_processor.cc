@@ -60,11 +60,17 @@ RegisterKeywords(
 { "parallelism", "the degree of ILP in the processor" },
 { "pipeline_speedup", "the degree of ILP in the processor" },
 { "node_pipeline_speedup", "DEPRECATED: a speedup factor for computation "},
+{ "compute_cache", "whether to reuse the time of repeated compute blocks when memory is otherwise idle" },
+{ "compute_cache_size", "the maximum number of compute blocks to cache per node" },
 );
 
 namespace sstmac {
 namespace hw {
 
+std::atomic<uint64_t> InstructionProcessor::cache_hits_(0);
+std::atomic<uint64_t> InstructionProcessor::cache_misses_(0);
+std::atomic<uint64_t> InstructionProcessor::cache_contended_(0);
+
 InstructionProcessor::~InstructionProcessor()
 {
 }
@@ -82,6 +88,9 @@ InstructionProcessor(SST::Params& params,
   tintop_ = tflop_;
   tmemseq_ = TimeDelta(1.0 / mem_freq_);
   tmemrnd_ = tmemseq_;
+
+  compute_cache_ = params.find<bool>("compute_cache", false);
+  compute_cache_size_ = params.find<long>("compute_cache_size", 1024);
 }
 
 
@@ -95,6 +104,20 @@ InstructionProcessor::instructionTime(sw::BasicComputeEvent* cmsg)
   return tsec;
 }
 
+bool
+InstructionProcessor::estimateCompute(Event* ev, TimeDelta& t)
+{
+  sw::BasicComputeEvent* bev = test_cast(sw::BasicComputeEvent, ev);
+  if (!bev) return false;
+
+  sw::basic_instructions_st& st = bev->data();
+  //anything with memory traffic needs the memory model
+  if (st.mem_sequential > negligible_bytes_) return false;
+
+  t = instructionTime(bev) / st.nthread;
+  return true;
+}
+
 void
 InstructionProcessor::compute(Event* ev, ExecutionEvent* cb)
 {
@@ -107,11 +130,43 @@ InstructionProcessor::compute(Event* ev, ExecutionEvent* cb)
   uint64_t bytes = st.mem_sequential;
   if (bytes <= negligible_bytes_) {
     node_->sendDelayedExecutionEvent(instr_time, cb);
-  } else {
+  } else if (!compute_cache_){
     //do the full memory modeling
     TimeDelta byte_request_delay = instr_time / bytes;
-    mem_->accessFlow(bytes, byte_request_delay, cb);
+    mem_->startFlow(bytes, byte_request_delay, cb);
+  } else if (mem_->flowsActive() > 0){
+    //other traffic would contend with this block
+    ++cache_contended_;
+    TimeDelta byte_request_delay = instr_time / bytes;
+    mem_->startFlow(bytes, byte_request_delay, cb);
+  } else {
+    ComputeSignature sig{st.flops, st.intops, bytes, nthread};
+    auto iter = cached_times_.find(sig);
+    TimeDelta byte_request_delay = instr_time / bytes;
+    if (iter != cached_times_.end()){
+      ++cache_hits_;
+      //the memory model still sees the block, so traffic starting during it contends
+      mem_->replayFlow(bytes, byte_request_delay, iter->second, cb);
+    } else {
+      ++cache_misses_;
+      uint64_t flow_id = mem_->flowsStarted() + 1;
+      mem_->startFlow(bytes, byte_request_delay,
+        newCallback(this, &InstructionProcessor::recordFlow, sig, node_->now(), flow_id, cb));
+    }
+  }
+}
+
+void
+InstructionProcessor::recordFlow(ComputeSignature sig, Timestamp start,
+                                 uint64_t flow_id, ExecutionEvent* cb)
+{
+  //the time is only reusable if no other flow shared the memory system
+  bool uncontended = mem_->flowsStarted() == flow_id;
+  if (uncontended && cached_times_.size() < compute_cache_size_){
+    cached_times_[sig] = node_->now() - start;
   }
+  cb->execute();
+  delete cb;
 }
 
 
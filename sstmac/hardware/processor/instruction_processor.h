@@ -50,6 +50,8 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/common/rng.h>
 #include <sstmac/hardware/noise/noise.h>
 #include <sstmac/hardware/processor/simple_processor.h>
+#include <unordered_map>
+#include <atomic>
 
 namespace sstmac {
 namespace hw {
@@ -73,6 +75,20 @@ class InstructionProcessor :
 
   void compute(Event* ev, ExecutionEvent* cb) override;
 
+  bool estimateCompute(Event* ev, TimeDelta& t) override;
+
+  static uint64_t numComputeCacheHits() {
+    return cache_hits_;
+  }
+
+  static uint64_t numComputeCacheMisses() {
+    return cache_misses_;
+  }
+
+  static uint64_t numComputeCacheContended() {
+    return cache_contended_;
+  }
+
  protected:
   void setMemopDistribution(double stdev);
 
@@ -88,6 +104,43 @@ class InstructionProcessor :
 
   uint64_t negligible_bytes_;
 
+ private:
+  /** The inputs that determine the length of a compute block */
+  struct ComputeSignature {
+    uint64_t flops;
+    uint64_t intops;
+    uint64_t bytes;
+    int nthread;
+
+    bool operator==(const ComputeSignature& other) const {
+      return flops == other.flops && intops == other.intops
+          && bytes == other.bytes && nthread == other.nthread;
+    }
+  };
+
+  struct ComputeSignatureHash {
+    std::size_t operator()(const ComputeSignature& sig) const {
+      std::size_t h = std::hash<uint64_t>()(sig.flops);
+      h = h * 31 + std::hash<uint64_t>()(sig.intops);
+      h = h * 31 + std::hash<uint64_t>()(sig.bytes);
+      return h * 31 + sig.nthread;
+    }
+  };
+
+  /**
+   * Cache the duration of a memory flow if no other flow started while it ran
+   */
+  void recordFlow(ComputeSignature sig, Timestamp start, uint64_t flow_id, ExecutionEvent* cb);
+
+  bool compute_cache_;
+  std::size_t compute_cache_size_;
+  /** Uncontended durations of compute blocks that went through the memory model */
+  std::unordered_map<ComputeSignature,TimeDelta,ComputeSignatureHash> cached_times_;
+
+  static std::atomic<uint64_t> cache_hits_;
+  static std::atomic<uint64_t> cache_misses_;
+  static std::atomic<uint64_t> cache_contended_;
+
 };
 
 }
@@ -75,6 +75,18 @@ class Processor
 
   virtual void compute(Event* cev, ExecutionEvent* cb) = 0;
 
+  /**
+   * @brief estimateCompute Compute the time for a compute event without
+   *        scheduling anything. This is only possible if the event does not
+   *        need contention modeling, e.g. in the memory system.
+   * @param cev The compute event
+   * @param t [out] The compute time
+   * @return Whether the time could be computed
+   */
+  virtual bool estimateCompute(Event* /*cev*/, TimeDelta& /*t*/){
+    return false;
+  }
+
   int ncores() const {
     return ncores_;
   }
@@ -258,8 +258,11 @@ class DragonflyPlusParRouter : public DragonflyPlusAlltoallMinimalRouter {
           valiantPort += dfly_->a(); //global ports offset by a
 
 
-          int valiantMetric = 2*netsw_->queueLength(valiantPort, all_vcs);
-          int minimalMetric = netsw_->queueLength(minimalPort, all_vcs);
+          int ports[] = {minimalPort, valiantPort};
+          int lengths[2];
+          netsw_->portOccupancies(ports, 2, lengths);
+          int valiantMetric = 2*lengths[1];
+          int minimalMetric = lengths[0];
 
           rter_debug("comparing minimal(%d) %d against non-minimal(%d) %d",
                      minimalPort, minimalMetric, valiantPort, valiantMetric);
@@ -217,8 +217,11 @@ class HypercubeParRouter : public HypercubeMinimalRouter {
          hdr->deadlock_vc = 0;
          return;
        }
-      int minLength = netsw_->queueLength(minimalPort, all_vcs);
-      int valLength = netsw_->queueLength(valiantPort, all_vcs) * 2;
+      int ports[] = {minimalPort, valiantPort};
+      int lengths[2];
+      netsw_->portOccupancies(ports, 2, lengths);
+      int minLength = lengths[0];
+      int valLength = lengths[1] * 2;
       if (minLength <= valLength){
         hdr->edge_port = minimalPort;
       } else {
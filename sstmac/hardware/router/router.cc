@@ -90,8 +90,17 @@ Router::switchPaths(
   int new_port,
   int vl) const
 {
-  int orig_queue_length = netsw_->queueLength(orig_port, vl);
-  int new_queue_length = netsw_->queueLength(new_port, vl);
+  int orig_queue_length, new_queue_length;
+  if (vl == all_vcs){
+    int ports[] = {orig_port, new_port};
+    int lengths[2];
+    netsw_->portOccupancies(ports, 2, lengths);
+    orig_queue_length = lengths[0];
+    new_queue_length = lengths[1];
+  } else {
+    orig_queue_length = netsw_->queueLength(orig_port, vl);
+    new_queue_length = netsw_->queueLength(new_port, vl);
+  }
   int orig_weight = orig_queue_length * orig_distance;
   int valiant_weight = new_queue_length * new_distance;
   rter_debug("comparing minimal(%d) %d=%dx%d against non-minimal(%d) %d=%dx%d",
@@ -78,6 +78,13 @@ class TableRouter : public Router {
     {
     }
 
+    template <class Range>
+    Port(const Range& range) :
+      ports(range.begin(), range.end()),
+      rotater(0)
+    {
+    }
+
     Port() : rotater(0), ports(0) {}
 
     int nextPort(){
@@ -106,33 +113,16 @@ class TableRouter : public Router {
   {
 
     FileTopology* file_topo = dynamic_cast<FileTopology*>(top);
-    nlohmann::json port_channels;
-    if (file_topo){
-      try {
-        nlohmann::json switch_ports = file_topo->getSwitchJson(my_addr_);
-        auto pch_it = switch_ports.find("port_channels");
-        if (pch_it != switch_ports.end()){
-          port_channels = *pch_it;
-        }
-      } catch (nlohmann::detail::exception& e) {
-        spkt_abort_printf("failed getting switch JSON info in TableRouter for switch %d",
-                          int(addr()));
-      }
-    }
-
-    nlohmann::json routes = top->getRoutingTable(my_addr_);
-    for (auto it = routes.begin(); it != routes.end(); ++it){
-      NodeId dest_nid = top->nodeNameToId(it.key());
-      if (it.value().is_number()){
-        //this is a single port
-        table_[dest_nid] = Port(int(it.value()));
-      } else {
-        std::string pch_name = it.value();
-        table_[dest_nid] = Port(port_channels.at(pch_name));
+    const FileTopologyImage* image = file_topo ? file_topo->image() : nullptr;
+    if (image && image->hasRoutes()){
+      //compiled image - routes and port groups are already resolved to ids
+      for (auto& r : image->routes(my_addr_)){
+        table_[r.dest] = Port(image->portGroup(r.group));
       }
+    } else {
+      initJsonRoutes(file_topo);
     }
 
-
     int size = table_.size();
     for (int i=0; i < size; ++i){
       if (table_[i].ports.size() == 0){
@@ -173,6 +163,34 @@ class TableRouter : public Router {
   }
 
  private:
+  void initJsonRoutes(FileTopology* file_topo){
+    nlohmann::json port_channels;
+    if (file_topo && !file_topo->image()){
+      try {
+        nlohmann::json switch_ports = file_topo->getSwitchJson(my_addr_);
+        auto pch_it = switch_ports.find("port_channels");
+        if (pch_it != switch_ports.end()){
+          port_channels = *pch_it;
+        }
+      } catch (nlohmann::detail::exception& e) {
+        spkt_abort_printf("failed getting switch JSON info in TableRouter for switch %d",
+                          int(addr()));
+      }
+    }
+
+    nlohmann::json routes = topology()->getRoutingTable(my_addr_);
+    for (auto it = routes.begin(); it != routes.end(); ++it){
+      NodeId dest_nid = topology()->nodeNameToId(it.key());
+      if (it.value().is_number()){
+        //this is a single port
+        table_[dest_nid] = Port(int(it.value()));
+      } else {
+        std::string pch_name = it.value();
+        table_[dest_nid] = Port(port_channels.at(pch_name));
+      }
+    }
+  }
+
   std::vector<Port> table_;
   bool increment_vcs_;
   int num_vcs_;
@@ -297,8 +297,11 @@ class TorusUGALRouter : public TorusValiantRouter {
         int ugal_dist = torus_->minimalDistance(my_addr_, inter) +
                         torus_->minimalDistance(inter, ej_addr);
 
-        int ugal_metric = netsw_->queueLength(ugal.edge_port, all_vcs) * ugal_dist;
-        int min_metric = netsw_->queueLength(min.edge_port, all_vcs) * min_dist;
+        int ports[] = {ugal.edge_port, min.edge_port};
+        int lengths[2];
+        netsw_->portOccupancies(ports, 2, lengths);
+        int ugal_metric = lengths[0] * ugal_dist;
+        int min_metric = lengths[1] * min_dist;
 
         if (ugal_metric < min_metric){
           hdr->dest_switch = inter;
@@ -47,7 +47,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <sstmac/hardware/common/packet.h>
 #include <sstmac/hardware/common/flow.h>
-#include <sprockit/thread_safe_new.h>
+#include <sprockit/object_pool.h>
 #include <sprockit/factory.h>
 #include <sprockit/debug.h>
 
@@ -65,11 +65,14 @@ namespace hw {
  */
 class SculpinPacket :
   public Packet,
-  public sprockit::thread_safe_new<SculpinPacket>
+  public sprockit::ObjectPool<SculpinPacket>
 {
   ImplementSerializable(SculpinPacket)
 
  public:
+  using sprockit::ObjectPool<SculpinPacket>::operator new;
+  using sprockit::ObjectPool<SculpinPacket>::operator delete;
+
   SculpinPacket(
     Flow* msg,
     uint32_t numBytes,
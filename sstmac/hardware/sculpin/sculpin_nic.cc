@@ -66,6 +66,7 @@ namespace hw {
 SculpinNIC::SculpinNIC(uint32_t id, SST::Params& params, Node* parent) :
   NIC(id, params, parent)
 {
+  cq_.setActiveFlowStat(recv_flows_);
   SST::Params inj_params = params.get_scoped_params("injection");
 
   packet_size_ = inj_params.find<SST::UnitAlgebra>("mtu").getRoundedValue();
@@ -93,16 +94,16 @@ LinkHandler*
 SculpinNIC::payloadHandler(int port)
 {
   if (port == NIC::LogP){
-    return newLinkHandler(this, &NIC::mtlHandle);
+    return newLinkHandler<NIC, &NIC::mtlHandle>(this);
   } else {
-    return newLinkHandler(this, &SculpinNIC::handlePayload);
+    return newLinkHandler<SculpinNIC, &SculpinNIC::handlePayload>(this);
   }
 }
 
 LinkHandler*
 SculpinNIC::creditHandler(int  /*port*/)
 {
-  return newLinkHandler(this, &SculpinNIC::handleCredit);
+  return newLinkHandler<SculpinNIC, &SculpinNIC::handleCredit>(this);
 }
 
 void
@@ -328,13 +328,13 @@ SculpinSwitch::toString() const
 LinkHandler*
 SculpinSwitch::creditHandler(int  /*port*/)
 {
-  return newLinkHandler(this, &SculpinSwitch::handleCredit);
+  return newLinkHandler<SculpinSwitch, &SculpinSwitch::handleCredit>(this);
 }
 
 LinkHandler*
 SculpinSwitch::payloadHandler(int  /*port*/)
 {
-  return newLinkHandler(this, &SculpinSwitch::handlePayload);
+  return newLinkHandler<SculpinSwitch, &SculpinSwitch::handlePayload>(this);
 }
 
 }
@@ -47,7 +47,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <sstmac/hardware/common/packet.h>
 #include <sstmac/hardware/common/flow.h>
-#include <sprockit/thread_safe_new.h>
+#include <sprockit/object_pool.h>
 #include <sprockit/factory.h>
 #include <sprockit/debug.h>
 
@@ -61,11 +61,14 @@ namespace hw {
  */
 class SnapprPacket :
   public Packet,
-  public sprockit::thread_safe_new<SnapprPacket>
+  public sprockit::ObjectPool<SnapprPacket>
 {
   ImplementSerializable(SnapprPacket)
 
  public:
+  using sprockit::ObjectPool<SnapprPacket>::operator new;
+  using sprockit::ObjectPool<SnapprPacket>::operator delete;
+
   SnapprPacket(
     Flow* msg,
     uint32_t numBytes,
@@ -200,11 +203,14 @@ class SnapprPacket :
  */
 class SnapprCredit :
   public Event,
-  public sprockit::thread_safe_new<SnapprCredit>
+  public sprockit::ObjectPool<SnapprCredit>
 {
   ImplementSerializable(SnapprCredit)
 
  public:
+  using sprockit::ObjectPool<SnapprCredit>::operator new;
+  using sprockit::ObjectPool<SnapprCredit>::operator delete;
+
   SnapprCredit(uint32_t num_bytes, int vl, int port) :
     num_bytes_(num_bytes),
     vl_(vl),
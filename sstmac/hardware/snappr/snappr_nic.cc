@@ -77,6 +77,7 @@ struct SnapprRequest : public MemoryModel::Request {
 SnapprNIC::SnapprNIC(uint32_t id, SST::Params& params, Node* parent) :
   NIC(id, params, parent)
 {
+  cq_.setActiveFlowStat(recv_flows_);
   packet_size_ = params.find<SST::UnitAlgebra>("mtu").getRoundedValue();
 
   SST::Params inj_params = params.get_scoped_params("injection");
@@ -169,9 +170,9 @@ LinkHandler*
 SnapprNIC::payloadHandler(int port)
 {
   if (port == NIC::LogP){
-    return newLinkHandler(this, &NIC::mtlHandle);
+    return newLinkHandler<NIC, &NIC::mtlHandle>(this);
   } else {
-    return newLinkHandler(this, &SnapprNIC::handlePayload);
+    return newLinkHandler<SnapprNIC, &SnapprNIC::handlePayload>(this);
   }
 }
 
@@ -188,7 +189,7 @@ SnapprNIC::deadlockCheck()
 LinkHandler*
 SnapprNIC::creditHandler(int  /*port*/)
 {
-  return newLinkHandler(this, &SnapprNIC::handleCredit);
+  return newLinkHandler<SnapprNIC, &SnapprNIC::handleCredit>(this);
 }
 
 void
@@ -238,6 +238,20 @@ SnapprSwitch::queueLength(int port, int  /*vc*/) const
   return outports_[port]->queueLength();
 }
 
+int
+SnapprSwitch::portOccupancy(int port) const
+{
+  return outports_[port]->queueLength();
+}
+
+void
+SnapprSwitch::portOccupancies(const int* ports, int num_ports, int* occupancies) const
+{
+  for (int i=0; i < num_ports; ++i){
+    occupancies[i] = outports_[ports[i]]->queueLength();
+  }
+}
+
 
 void
 SnapprSwitch::deadlockCheck()
@@ -295,14 +309,14 @@ LinkHandler*
 SnapprSwitch::creditHandler(int port)
 {
   switch_debug("returning credit handler on output port %d", port);
-  return newLinkHandler(outports_[port], &SnapprOutPort::handle);
+  return newLinkHandler<SnapprOutPort, &SnapprOutPort::handle>(outports_[port]);
 }
 
 LinkHandler*
 SnapprSwitch::payloadHandler(int port)
 {
   switch_debug("returning payload handler on input port %d", port);
-  return newLinkHandler(&inports_[port], &SnapprInPort::handle);
+  return newLinkHandler<SnapprInPort, &SnapprInPort::handle>(&inports_[port]);
 }
 
 
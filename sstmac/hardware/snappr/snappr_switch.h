@@ -96,6 +96,10 @@ class SnapprSwitch :
 
   int queueLength(int port, int vc) const override;
 
+  int portOccupancy(int port) const override;
+
+  void portOccupancies(const int* ports, int num_ports, int* occupancies) const override;
+
   void connectOutput(int src_outport, int dst_inport, EventLink::ptr&& link) override;
 
   void connectInput(int src_outport, int dst_inport, EventLink::ptr&& link) override;
@@ -104,6 +104,32 @@ class NetworkSwitch :
    */
   virtual int queueLength(int port, int vc) const = 0;
 
+  /**
+   * @brief portOccupancy
+   * The queue length of a port summed over all VCs. Switch models that keep
+   * a running total per port, updated on enqueue and dequeue, override this
+   * so that adaptive routing never loops over VCs.
+   * @param port The port to check
+   * @return The total queue length as an integer number of packets waiting
+   */
+  virtual int portOccupancy(int port) const {
+    return queueLength(port, -1);
+  }
+
+  /**
+   * @brief portOccupancies
+   * Score a batch of candidate ports for an adaptive routing decision
+   * with a single call into the switch.
+   * @param ports The candidate ports
+   * @param num_ports The number of candidates
+   * @param occupancies [OUT] The total queue length of each candidate
+   */
+  virtual void portOccupancies(const int* ports, int num_ports, int* occupancies) const {
+    for (int i=0; i < num_ports; ++i){
+      occupancies[i] = portOccupancy(ports[i]);
+    }
+  }
+
  protected:
   NetworkSwitch(uint32_t id, SST::Params& params);
 
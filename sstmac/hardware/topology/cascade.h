@@ -166,6 +166,10 @@ class Cascade : public CartesianTopology
     return (sid / (x_*y_));
   }
 
+  int switchGroup(SwitchId sid) const override {
+    return computeG(sid);
+  }
+
   SwitchId numSwitches() const override {
     return x_ * y_ * g_;
   }
@@ -205,6 +205,10 @@ class Dragonfly : public CartesianTopology
     return sid / a_;
   }
 
+  int switchGroup(SwitchId sid) const override {
+    return computeG(sid);
+  }
+
   SwitchId numSwitches() const override {
     return a_ * g_;
   }
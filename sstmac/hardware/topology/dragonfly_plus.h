@@ -165,6 +165,10 @@ class DragonflyPlus : public Dragonfly
     return (sid % num_leaf_switches_) / a_;
   }
 
+  int switchGroup(SwitchId sid) const override {
+    return computeG(sid);
+  }
+
   SwitchId numSwitches() const override {
     return 2 * a_ * g_;
   }
@@ -131,6 +131,10 @@ class FatTree :
     }
   }
 
+  int switchGroup(SwitchId sid) const override {
+    return subtree(sid);
+  }
+
   int maxNumPorts() const override {
     int first_max = std::max(concentration() + up_ports_per_leaf_switch_,
                              down_ports_per_agg_switch_ + up_ports_per_agg_switch_);
@@ -55,9 +55,21 @@ namespace sstmac {
 namespace hw {
 
 FileTopology::FileTopology(SST::Params& params) :
-  Topology(params)
+  Topology(params),
+  image_(nullptr)
 {
   std::string fname = params.find<std::string>("filename");
+  if (FileTopologyImage::isImage(fname)){
+    top_debug("file topology: mapping compiled image %s", fname.c_str());
+    image_ = new FileTopologyImage(fname);
+    num_hops_ = image_->avgNumHops();
+    num_nodes_ = image_->numNodes();
+    num_switches_ = image_->numSwitches();
+    num_leaf_switches_ = image_->numLeafSwitches();
+    maxNumPorts_ = image_->maxNumPorts();
+    return;
+  }
+
   std::ifstream in(fname);
   if( in.fail() )
     spkt_throw_printf(sprockit::InputError,
@@ -134,7 +146,17 @@ FileTopology::FileTopology(SST::Params& params) :
     }
   }
 
+  if (params.contains("compile_image")){
+    std::string image_fname = params.find<std::string>("compile_image");
+    const nlohmann::json& routes = routingTables();
+    FileTopologyImage::compile(json_, routes.is_null() ? nullptr : &routes, image_fname);
+  }
+
+}
 
+FileTopology::~FileTopology()
+{
+  if (image_) delete image_;
 }
 
 void
@@ -143,11 +165,48 @@ FileTopology::initHostnameMap(SST::Params& /*params*/)
   //this is done in the constructor
 }
 
+NodeId
+FileTopology::nodeNameToId(const std::string& name) const
+{
+  if (image_){
+    int nid = image_->nodeId(name);
+    if (nid < 0){
+      spkt_abort_printf("topology: can't find %s in hostname map", name.c_str());
+    }
+    return nid;
+  }
+  return Topology::nodeNameToId(name);
+}
+
+std::string
+FileTopology::nodeIdToName(NodeId id)
+{
+  if (image_){
+    if (id >= NodeId(num_nodes_)){
+      spkt_abort_printf("Invalid node id %d given to topology::nodeIdToName", id);
+    }
+    return image_->nodeName(id);
+  }
+  return Topology::nodeIdToName(id);
+}
+
 void
 FileTopology::connectedOutports(SwitchId src, std::vector<Connection>& conns) const
 {
   conns.clear();
 
+  if (image_){
+    for (auto& c : image_->outports(src)){
+      Connection conn;
+      conn.src = src;
+      conn.src_outport = c.src_outport;
+      conn.dst = c.dst;
+      conn.dst_inport = c.dst_inport;
+      conns.push_back(conn);
+    }
+    return;
+  }
+
   auto iter = switch_id_map_.find(src);
   if (iter == switch_id_map_.end()){
     spkt_abort_printf("Switch %d not found in json map", src);
@@ -175,6 +234,17 @@ FileTopology::endpointsConnectedToInjectionSwitch(SwitchId swaddr,
 {
   nodes.clear();
 
+  if (image_){
+    for (auto& inj : image_->injections(swaddr)){
+      InjectionPort ip;
+      ip.nid = inj.nid;
+      ip.ep_port = inj.ep_port;
+      ip.switch_port = inj.switch_port;
+      nodes.push_back(ip);
+    }
+    return;
+  }
+
   // find switch name
   string key;
   for (auto &i : switch_name_map_) {
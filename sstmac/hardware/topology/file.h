@@ -47,6 +47,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <utility>
 #include <sstmac/hardware/topology/structured_topology.h>
+#include <sstmac/hardware/topology/file_image.h>
 #include <sstmac/libraries/nlohmann/json.hpp>
 
 namespace sstmac {
@@ -55,6 +56,9 @@ namespace hw {
 /**
  *  @class file
  *  The file topology generates a network by reading from a file.
+ *  The file can either be a JSON description or a binary image
+ *  compiled from JSON (see FileTopologyImage), which is memory-mapped
+ *  instead of parsed.
  */
 class FileTopology : public Topology
 {
@@ -70,7 +74,7 @@ class FileTopology : public Topology
     return "file topology";
   }
 
-  ~FileTopology() override {}
+  ~FileTopology() override;
 
   FileTopology(SST::Params& params);
 
@@ -87,7 +91,7 @@ class FileTopology : public Topology
   }
 
   SwitchId endpointToSwitch(NodeId id) const override {
-    return node_to_switch_[id];
+    return image_ ? image_->nodeToSwitch(id) : node_to_switch_[id];
   }
 
   SwitchId numLeafSwitches() const override {
@@ -125,6 +129,13 @@ class FileTopology : public Topology
   }
 
   SwitchId switchNameToId(std::string name) const override {
+    if (image_){
+      int sid = image_->switchId(name);
+      if (sid < 0)
+        spkt_throw_printf(sprockit::InputError,
+          "file topology: can't find switch id for %s", name.c_str());
+      return SwitchId(sid);
+    }
     auto it = switch_name_map_.find(name);
     if( it == switch_name_map_.end())
       spkt_throw_printf(sprockit::InputError,
@@ -133,14 +144,29 @@ class FileTopology : public Topology
   }
 
   std::string switchIdToName(SwitchId id) const override {
+    if (image_) return image_->switchName(id);
     return switch_id_map_.at(id);
   }
 
+  NodeId nodeNameToId(const std::string& name) const override;
+
+  std::string nodeIdToName(NodeId id) override;
+
   nlohmann::json getSwitchJson(SwitchId sid) const {
+    if (image_){
+      spkt_abort_printf("file topology: no JSON switch description when running from image");
+    }
     std::string name = switchIdToName(sid);
     return switches_.at(name);
   }
 
+  /**
+   * @return The compiled image if the topology was loaded from one, otherwise null
+   */
+  const FileTopologyImage* image() const {
+    return image_;
+  }
+
  private:
   void initHostnameMap(SST::Params& params) override;
 
@@ -149,6 +175,7 @@ class FileTopology : public Topology
   int num_leaf_switches_;
   int maxNumPorts_;
   int num_hops_;
+  FileTopologyImage* image_;
   nlohmann::json json_;
   nlohmann::json switches_;
   nlohmann::json nodes_;
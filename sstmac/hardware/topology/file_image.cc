@@ -0,0 +1,334 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#include <sstmac/hardware/topology/file_image.h>
+#include <sprockit/errors.h>
+#include <sprockit/spkt_printf.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace nlohmann;
+
+namespace sstmac {
+namespace hw {
+
+const char FileTopologyImage::magic_[8] = {'S','S','T','T','O','P','O','\0'};
+
+namespace {
+
+struct SectionWriter {
+  std::vector<char> buffer;
+
+  template <class T>
+  void append(const std::vector<T>& vec){
+    const char* data = reinterpret_cast<const char*>(vec.data());
+    buffer.insert(buffer.end(), data, data + vec.size()*sizeof(T));
+    //keep every section 8-byte aligned
+    while (buffer.size() % 8) buffer.push_back(0);
+  }
+};
+
+void
+appendName(const std::string& name, std::vector<char>& names, std::vector<uint64_t>& offsets)
+{
+  names.insert(names.end(), name.begin(), name.end());
+  offsets.push_back(names.size());
+}
+
+std::vector<int32_t>
+sortedIndex(const std::vector<std::string>& names)
+{
+  std::vector<int32_t> idx(names.size());
+  for (int i=0; i < int(idx.size()); ++i) idx[i] = i;
+  std::sort(idx.begin(), idx.end(), [&](int32_t a, int32_t b){
+    return names[a] < names[b];
+  });
+  return idx;
+}
+
+}
+
+void
+FileTopologyImage::compile(const json& topology, const json* routes, const std::string& fname)
+{
+  Header hdr;
+  ::memset(&hdr, 0, sizeof(Header));
+  ::memcpy(hdr.magic, magic_, sizeof(magic_));
+  hdr.version = version_;
+  hdr.avg_num_hops = topology.at("avg_num_hops");
+  hdr.has_routes = routes ? 1 : 0;
+
+  //node and switch ids follow the iteration order FileTopology uses for JSON input
+  const json& nodes = topology.at("nodes");
+  const json& switches = topology.at("switches");
+  std::map<std::string,int> node_ids;
+  std::map<std::string,int> switch_ids;
+  std::vector<std::string> node_list;
+  std::vector<std::string> switch_list;
+  for (auto it = nodes.begin(); it != nodes.end(); ++it){
+    node_ids[it.key()] = node_list.size();
+    node_list.push_back(it.key());
+  }
+  for (auto it = switches.begin(); it != switches.end(); ++it){
+    switch_ids[it.key()] = switch_list.size();
+    switch_list.push_back(it.key());
+  }
+  hdr.num_nodes = node_list.size();
+  hdr.num_switches = switch_list.size();
+
+  std::vector<int32_t> node_to_sw(hdr.num_nodes, -1);
+  std::vector<uint64_t> conn_off(1, 0);
+  std::vector<Connection> conn_vec;
+  std::vector<uint64_t> inj_off(1, 0);
+  std::vector<Injection> inj_vec;
+  std::vector<uint64_t> route_off(1, 0);
+  std::vector<Route> route_vec;
+  std::vector<uint64_t> group_off(1, 0);
+  std::vector<int32_t> group_vec;
+
+  int max_ports = 0;
+  int max_node_ports = 0;
+  int num_leaf = 0;
+  for (int sid=0; sid < hdr.num_switches; ++sid){
+    const json& sw = switches.at(switch_list[sid]);
+    const json& outports = sw.at("outports");
+    int node_ports = 0;
+    for (auto prt = outports.begin(); prt != outports.end(); ++prt){
+      std::string dst = prt->at("destination");
+      int port = std::stoi(prt.key());
+      int inport = prt->at("inport");
+      auto nd = node_ids.find(dst);
+      if (nd != node_ids.end()){
+        ++node_ports;
+        node_to_sw[nd->second] = sid;
+        Injection inj;
+        inj.nid = nd->second;
+        inj.ep_port = inport;
+        inj.switch_port = port;
+        inj_vec.push_back(inj);
+      }
+      auto sw_it = switch_ids.find(dst);
+      if (sw_it != switch_ids.end()){
+        max_ports = std::max(max_ports, port);
+        max_ports = std::max(max_ports, inport);
+        Connection c;
+        c.src_outport = port;
+        c.dst = sw_it->second;
+        c.dst_inport = inport;
+        conn_vec.push_back(c);
+      }
+    }
+    if (node_ports) ++num_leaf;
+    max_node_ports = std::max(max_node_ports, node_ports);
+    conn_off.push_back(conn_vec.size());
+    inj_off.push_back(inj_vec.size());
+
+    if (routes){
+      auto sw_routes = routes->find(switch_list[sid]);
+      if (sw_routes != routes->end()){
+        std::map<std::string,uint32_t> channel_groups;
+        std::map<int,uint32_t> port_groups;
+        const json& table = sw_routes->at("routes");
+        for (auto it = table.begin(); it != table.end(); ++it){
+          auto nd = node_ids.find(it.key());
+          if (nd == node_ids.end()){
+            spkt_throw_printf(sprockit::InputError,
+              "file topology image: route to unknown node %s on switch %s",
+              it.key().c_str(), switch_list[sid].c_str());
+          }
+          Route r;
+          r.dest = nd->second;
+          if (it.value().is_number()){
+            int port = it.value();
+            auto grp = port_groups.find(port);
+            if (grp == port_groups.end()){
+              r.group = group_off.size() - 1;
+              port_groups[port] = r.group;
+              group_vec.push_back(port);
+              group_off.push_back(group_vec.size());
+            } else {
+              r.group = grp->second;
+            }
+          } else {
+            std::string pch_name = it.value();
+            auto grp = channel_groups.find(pch_name);
+            if (grp == channel_groups.end()){
+              r.group = group_off.size() - 1;
+              channel_groups[pch_name] = r.group;
+              for (auto p : sw.at("port_channels").at(pch_name).at("ports")){
+                group_vec.push_back(p);
+              }
+              group_off.push_back(group_vec.size());
+            } else {
+              r.group = grp->second;
+            }
+          }
+          route_vec.push_back(r);
+        }
+      }
+    }
+    route_off.push_back(route_vec.size());
+  }
+
+  hdr.num_leaf_switches = num_leaf;
+  // +2 because we start indexing at zero, same as the JSON path
+  hdr.max_num_ports = max_ports + max_node_ports + 2;
+
+  std::vector<uint64_t> node_name_off(1, 0);
+  std::vector<char> node_name_vec;
+  for (auto& name : node_list) appendName(name, node_name_vec, node_name_off);
+  std::vector<uint64_t> switch_name_off(1, 0);
+  std::vector<char> switch_name_vec;
+  for (auto& name : switch_list) appendName(name, switch_name_vec, switch_name_off);
+
+  SectionWriter writer;
+  auto add = [&](section_t s, size_t size, std::function<void()> fxn){
+    hdr.offsets[s] = sizeof(Header) + writer.buffer.size();
+    hdr.sizes[s] = size;
+    fxn();
+  };
+  add(node_to_switch, node_to_sw.size(), [&]{ writer.append(node_to_sw); });
+  add(conn_offsets, conn_off.size(), [&]{ writer.append(conn_off); });
+  add(conns, conn_vec.size(), [&]{ writer.append(conn_vec); });
+  add(injection_offsets, inj_off.size(), [&]{ writer.append(inj_off); });
+  add(injection_ports, inj_vec.size(), [&]{ writer.append(inj_vec); });
+  add(node_name_offsets, node_name_off.size(), [&]{ writer.append(node_name_off); });
+  add(node_names, node_name_vec.size(), [&]{ writer.append(node_name_vec); });
+  add(node_sorted, node_list.size(), [&]{ writer.append(sortedIndex(node_list)); });
+  add(switch_name_offsets, switch_name_off.size(), [&]{ writer.append(switch_name_off); });
+  add(switch_names, switch_name_vec.size(), [&]{ writer.append(switch_name_vec); });
+  add(switch_sorted, switch_list.size(), [&]{ writer.append(sortedIndex(switch_list)); });
+  add(route_offsets, route_off.size(), [&]{ writer.append(route_off); });
+  add(route_entries, route_vec.size(), [&]{ writer.append(route_vec); });
+  add(group_offsets, group_off.size(), [&]{ writer.append(group_off); });
+  add(group_ports, group_vec.size(), [&]{ writer.append(group_vec); });
+  hdr.file_size = sizeof(Header) + writer.buffer.size();
+
+  std::ofstream out(fname, std::ios::binary);
+  if (!out.good()){
+    spkt_throw_printf(sprockit::InputError,
+      "file topology image: failed to open %s for writing", fname.c_str());
+  }
+  out.write(reinterpret_cast<const char*>(&hdr), sizeof(Header));
+  out.write(writer.buffer.data(), writer.buffer.size());
+}
+
+bool
+FileTopologyImage::isImage(const std::string& fname)
+{
+  std::ifstream in(fname, std::ios::binary);
+  char magic[sizeof(magic_)];
+  in.read(magic, sizeof(magic));
+  return in.good() && ::memcmp(magic, magic_, sizeof(magic_)) == 0;
+}
+
+FileTopologyImage::FileTopologyImage(const std::string& fname)
+{
+  int fd = ::open(fname.c_str(), O_RDONLY);
+  if (fd < 0){
+    spkt_throw_printf(sprockit::InputError,
+      "file topology image: failed to open %s", fname.c_str());
+  }
+  struct stat st;
+  ::fstat(fd, &st);
+  size_ = st.st_size;
+  if (size_ < sizeof(Header)){
+    ::close(fd);
+    spkt_throw_printf(sprockit::InputError,
+      "file topology image: %s is too small to be an image", fname.c_str());
+  }
+  void* ptr = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (ptr == MAP_FAILED){
+    spkt_throw_printf(sprockit::InputError,
+      "file topology image: failed to mmap %s", fname.c_str());
+  }
+  base_ = static_cast<const char*>(ptr);
+  header_ = reinterpret_cast<const Header*>(base_);
+  if (::memcmp(header_->magic, magic_, sizeof(magic_)) != 0
+      || header_->version != version_
+      || header_->file_size != size_){
+    ::munmap(ptr, size_);
+    spkt_throw_printf(sprockit::InputError,
+      "file topology image: %s is not a valid version %u image", fname.c_str(), version_);
+  }
+}
+
+FileTopologyImage::~FileTopologyImage()
+{
+  ::munmap(const_cast<char*>(base_), size_);
+}
+
+int
+FileTopologyImage::find(section_t offsets, section_t data, section_t sorted,
+                        int num, const std::string& name) const
+{
+  const int32_t* idx = section<int32_t>(sorted);
+  int lo = 0;
+  int hi = num;
+  while (lo < hi){
+    int mid = (lo + hi) / 2;
+    auto r = csr<char>(offsets, data, idx[mid]);
+    int cmp = name.compare(0, std::string::npos, r.first, r.size());
+    if (cmp == 0){
+      return idx[mid];
+    } else if (cmp < 0){
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return -1;
+}
+
+}
+} //end of namespace sstmac
@@ -0,0 +1,251 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#ifndef SSTMAC_HARDWARE_NETWORK_TOPOLOGY_FILE_IMAGE_H_INCLUDED
+#define SSTMAC_HARDWARE_NETWORK_TOPOLOGY_FILE_IMAGE_H_INCLUDED
+
+#include <sstmac/common/node_address.h>
+#include <sstmac/libraries/nlohmann/json.hpp>
+#include <cstdint>
+#include <string>
+
+namespace sstmac {
+namespace hw {
+
+/**
+ * @class FileTopologyImage
+ * A compact, read-only binary image of a JSON file topology (and optionally
+ * its routing tables). The image is compiled once from JSON and then mapped
+ * into memory with mmap, so every rank and thread shares the same pages and no
+ * JSON is parsed at simulation time.
+ *
+ * Layout: a fixed header followed by 8-byte aligned sections holding
+ * CSR adjacency (switch-to-switch outports, injection ports), node-to-switch map,
+ * node/switch name tables with sorted indices for name lookup,
+ * and per-switch routing entries referencing deduplicated port groups.
+ */
+class FileTopologyImage
+{
+ public:
+  struct Connection {
+    int32_t src_outport;
+    int32_t dst;
+    int32_t dst_inport;
+  };
+
+  struct Injection {
+    int32_t nid;
+    int32_t ep_port;
+    int32_t switch_port;
+  };
+
+  struct Route {
+    int32_t dest;
+    uint32_t group;
+  };
+
+  template <class T>
+  struct Range {
+    const T* first;
+    const T* last;
+    const T* begin() const { return first; }
+    const T* end() const { return last; }
+    size_t size() const { return last - first; }
+  };
+
+  /**
+   * Compile a JSON topology (and optional routing tables) into a binary image
+   * @param topology  The JSON topology in the format accepted by FileTopology
+   * @param routes    The "switches" object of a routing table JSON, or null
+   * @param fname     The image file to write
+   */
+  static void compile(const nlohmann::json& topology,
+                      const nlohmann::json* routes,
+                      const std::string& fname);
+
+  /**
+   * @return Whether the file starts with the image magic number
+   */
+  static bool isImage(const std::string& fname);
+
+  FileTopologyImage(const std::string& fname);
+
+  ~FileTopologyImage();
+
+  int numNodes() const {
+    return header_->num_nodes;
+  }
+
+  int numSwitches() const {
+    return header_->num_switches;
+  }
+
+  int numLeafSwitches() const {
+    return header_->num_leaf_switches;
+  }
+
+  int maxNumPorts() const {
+    return header_->max_num_ports;
+  }
+
+  int avgNumHops() const {
+    return header_->avg_num_hops;
+  }
+
+  bool hasRoutes() const {
+    return header_->has_routes;
+  }
+
+  SwitchId nodeToSwitch(NodeId nid) const {
+    return section<int32_t>(node_to_switch)[nid];
+  }
+
+  Range<Connection> outports(SwitchId sid) const {
+    return csr<Connection>(conn_offsets, conns, sid);
+  }
+
+  Range<Injection> injections(SwitchId sid) const {
+    return csr<Injection>(injection_offsets, injection_ports, sid);
+  }
+
+  Range<Route> routes(SwitchId sid) const {
+    return csr<Route>(route_offsets, route_entries, sid);
+  }
+
+  Range<int32_t> portGroup(uint32_t group) const {
+    return csr<int32_t>(group_offsets, group_ports, group);
+  }
+
+  std::string nodeName(NodeId nid) const {
+    return name(node_name_offsets, node_names, nid);
+  }
+
+  std::string switchName(SwitchId sid) const {
+    return name(switch_name_offsets, switch_names, sid);
+  }
+
+  /**
+   * @return The node id or -1 if not found
+   */
+  int nodeId(const std::string& name) const {
+    return find(node_name_offsets, node_names, node_sorted, numNodes(), name);
+  }
+
+  /**
+   * @return The switch id or -1 if not found
+   */
+  int switchId(const std::string& name) const {
+    return find(switch_name_offsets, switch_names, switch_sorted, numSwitches(), name);
+  }
+
+ private:
+  enum section_t {
+    node_to_switch = 0,
+    conn_offsets,
+    conns,
+    injection_offsets,
+    injection_ports,
+    node_name_offsets,
+    node_names,
+    node_sorted,
+    switch_name_offsets,
+    switch_names,
+    switch_sorted,
+    route_offsets,
+    route_entries,
+    group_offsets,
+    group_ports,
+    num_sections
+  };
+
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    int32_t num_nodes;
+    int32_t num_switches;
+    int32_t num_leaf_switches;
+    int32_t max_num_ports;
+    int32_t avg_num_hops;
+    int32_t has_routes;
+    int32_t padding;
+    uint64_t file_size;
+    uint64_t offsets[num_sections];
+    uint64_t sizes[num_sections];
+  };
+
+  static const char magic_[8];
+  static constexpr uint32_t version_ = 1;
+
+  template <class T>
+  const T* section(section_t s) const {
+    return reinterpret_cast<const T*>(base_ + header_->offsets[s]);
+  }
+
+  template <class T>
+  Range<T> csr(section_t offsets, section_t data, int idx) const {
+    const uint64_t* off = section<uint64_t>(offsets);
+    const T* d = section<T>(data);
+    Range<T> r;
+    r.first = d + off[idx];
+    r.last = d + off[idx+1];
+    return r;
+  }
+
+  std::string name(section_t offsets, section_t data, int idx) const {
+    auto r = csr<char>(offsets, data, idx);
+    return std::string(r.first, r.size());
+  }
+
+  int find(section_t offsets, section_t data, section_t sorted,
+           int num, const std::string& name) const;
+
+  const char* base_;
+  const Header* header_;
+  size_t size_;
+};
+
+}
+} //end of namespace sstmac
+
+#endif
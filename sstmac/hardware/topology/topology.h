@@ -396,6 +396,18 @@ class Topology : public sprockit::printable
 
   virtual SwitchId endpointToSwitch(NodeId) const = 0;
 
+  /**
+   * @brief switchGroup
+   * Topologies with a notion of locality above the switch (dragonfly groups,
+   * fat-tree subtrees) map each switch to a group id. By default, every
+   * switch is its own group.
+   * @param sid
+   * @return The group id the switch belongs to
+   */
+  virtual int switchGroup(SwitchId sid) const {
+    return sid;
+  }
+
   /**
    * @brief outputGraphviz
    * Request to output graphviz. If file is given, output will be written there.
@@ -480,7 +492,7 @@ class Topology : public sprockit::printable
 
   virtual CartesianTopology* cartTopology() const;
 
-  NodeId nodeNameToId(const std::string& name) const;
+  virtual NodeId nodeNameToId(const std::string& name) const;
 
   virtual SwitchId switchNameToId(std::string name) const {
     std::size_t pos = name.find("switch");
@@ -528,6 +540,13 @@ class Topology : public sprockit::printable
 
   virtual void portConfigDump(const std::string& dumpFile);
 
+  /**
+   * @return The per-switch routing tables given by the routing_tables parameter (null if none)
+   */
+  const nlohmann::json& routingTables() const {
+    return routing_tables_;
+  }
+
  protected:
   static Topology* main_top_;
   std::unordered_map<std::string,NodeId> idmap_;
@@ -266,6 +266,8 @@ SSTMAC_pthread_mutex_lock(sstmac_pthread_mutex_t* mutex)
   }
 
   Thread* thr = currentThread();
+  //pending compute must elapse before this thread can wait on or hand off a mutex
+  thr->flushCompute();
   pthread_debug("locking mutex %d for thread %ld for app %d",
                 *mutex, thr->threadId(), int(thr->parentApp()->tid()));
   mutex_t* mut = thr->parentApp()->getMutex(*mutex);
@@ -323,6 +325,7 @@ SSTMAC_pthread_mutex_unlock(sstmac_pthread_mutex_t * mutex)
   }
 
   Thread* thr = currentThread();
+  thr->flushCompute();
   mutex_t* mut = thr->parentApp()->getMutex(*mutex);
   if (mut == 0 || !mut->locked){
     return EINVAL;
@@ -424,6 +427,7 @@ SSTMAC_pthread_cond_timedwait(sstmac_pthread_cond_t * cond,
   }
 
   Thread* thr = currentThread();
+  thr->flushCompute();
   condition_t* pending = thr->parentApp()->getCondition(*cond);
   if (pending == 0){
     return EINVAL;
@@ -480,6 +484,7 @@ SSTMAC_pthread_cond_signal(sstmac_pthread_cond_t * cond)
   }
 
   Thread* thr = currentThread();
+  thr->flushCompute();
   condition_t* pending = thr->parentApp()->getCondition(*cond);
   if (pending == 0){
     return EINVAL;
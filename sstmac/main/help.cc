@@ -68,6 +68,7 @@ printHelp(int  /*argc*/, char **argv)
             << "\t[(--include|-i)           <value> ]    \n"
             << "\t[(--runnumber|-r)         <value> ]    \n"
             << "\t[(--cpu-affinity|-c)      <value>,<value>,... ]    \n"
+            << "\t[(--sim-stats|-S)         <file> ]     \n"
             << "\n"
 
             << "Configuration file is not optional. See parameters.ini for \n"
@@ -82,6 +83,8 @@ printHelp(int  /*argc*/, char **argv)
             << "and can turn off printing the simulation at the end with -m notime \n"
             << "\n--cpu-affinity takes a comma separated list of processor affinities\n"
             << "with size equal to the number of PDES tasks per node\n"
+            << "\n--sim-stats (-S) writes simulator throughput (events, events/sec,\n"
+            << "wall time per phase, peak RSS, object pools) as JSON to the given file\n"
             << "\n" << "Valid arguments to --debug (-d) are strings of the form \n"
             << "\"<(debug|stats)> (name1) | (name2) | ... \" \n"
             << "\t- examples: \n"
@@ -162,7 +162,17 @@ param_remap remap_list[] = {
 void
 remapParams(sprockit::SimParameters::ptr params, bool verbose)
 {
-  TimeDelta::initStamps(100);
+  //ticks default to 100 as, which only holds about 30 minutes of simulated time
+  TimeDelta::tick_t asec_per_tick = 100;
+  if (params->hasParam("timestamp_resolution")){
+    double resolution = params->getTimeParam("timestamp_resolution");
+    asec_per_tick = TimeDelta::tick_t(resolution * 1e18 + 0.5);
+    if (asec_per_tick == 0 || 1000000000000000000ULL % asec_per_tick){
+      spkt_abort_printf("timestamp_resolution=%s must be at least 1as and divide a second evenly",
+                        params->getParam("timestamp_resolution").c_str());
+    }
+  }
+  TimeDelta::initStamps(asec_per_tick);
 
   sprockit::SimParameters::ptr top_params = params->getNamespace("topology");
   bool auto_top = top_params->getOptionalBoolParam("auto", false);
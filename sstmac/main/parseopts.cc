@@ -133,13 +133,14 @@ parseOpts(int argc, char **argv, opts &oo)
     { "graph", required_argument, NULL, 'g' },
     { "xyz", required_argument, NULL, 'x' },
     { "dump-params", required_argument, NULL, 'D'},
+    { "sim-stats", required_argument, NULL, 'S'},
     { NULL, 0, NULL, '\0' }
   };
   int ch;
   bool errorflag = false;
   std::list<std::pair<std::string, std::string> > paramlist;
   optind = 1;
-  while ((ch = getopt_long(argc, argv, "Phad:f:t:p:m:n:u:i:c:b:V:g:D:o:e:", gopt, NULL))
+  while ((ch = getopt_long(argc, argv, "Phad:f:t:p:m:n:u:i:c:b:V:g:D:o:e:S:", gopt, NULL))
          != -1) {
     switch (ch) {
       case 0:
@@ -176,6 +177,9 @@ parseOpts(int argc, char **argv, opts &oo)
       case 'D':
         oo.params_dump_file = optarg;
         break;
+      case 'S':
+        oo.sim_stats_file = optarg;
+        break;
       case 'f':
         oo.configfile = optarg;
         oo.got_config_file = true;
@@ -48,6 +48,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstream>
 #include <iterator>
 #include <stdint.h>
+#include <cinttypes>
 #include <ctype.h>
 #include <errno.h>
 #include <math.h>
@@ -71,11 +72,17 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sprockit/output.h>
 #include <sprockit/basic_string_tokenizer.h>
 #include <sprockit/keyword_registration.h>
+#include <sprockit/object_pool.h>
 #include <sstmac/common/event_manager.h>
 #include <sstmac/backends/native/serial_runtime.h>
 #include <sstmac/software/process/app.h>
 #include <sstmac/software/process/operating_system.h>
 #include <sstmac/hardware/node/simple_node.h>
+#include <sstmac/software/libraries/compute/compute_event.h>
+#include <sstmac/hardware/processor/instruction_processor.h>
+#include <sstmac/libraries/nlohmann/json.hpp>
+#include <sys/resource.h>
+#include <fstream>
 
 #if SSTMAC_REPO_BUILD
 #include <sstmac_repo.h>
@@ -221,6 +228,7 @@ runParams(opts& oo,
 
   rt->initPartitionParams(params);
 
+  double setup_start = sstmacWallTime();
   native::Manager* mgr = new native::Manager(params, rt);
 
   //dumping the output graph can be activated either on the command line
@@ -234,6 +242,8 @@ runParams(opts& oo,
   mgr->interconnect()->topology()->outputXYZ(oo.outputXYZ);
 
   double start = sstmacWallTime();
+  stats.setupTime = start - setup_start;
+  double finish_start = start;
   Timestamp stop_time(params.find<SST::UnitAlgebra>("stop_time", "0s").getValue().toDouble());
   Timestamp runtime;
   try {
@@ -248,6 +258,13 @@ runParams(opts& oo,
     //mgr->interconnect()->deadlock_check();
     Runtime::checkDeadlock();
 
+    finish_start = sstmacWallTime();
+    stats.numEvents = mgr->numEvents();
+    stats.lazyComputeCalls = rt->globalSum(sw::Thread::numLazyComputeCalls());
+    stats.lazyComputeFlushes = rt->globalSum(sw::Thread::numLazyComputeFlushes());
+    stats.computeCacheHits = rt->globalSum(hw::InstructionProcessor::numComputeCacheHits());
+    stats.computeCacheMisses = rt->globalSum(hw::InstructionProcessor::numComputeCacheMisses());
+    stats.computeCacheContended = rt->globalSum(hw::InstructionProcessor::numComputeCacheContended());
     mgr->finish();
 
     delete mgr;
@@ -262,6 +279,8 @@ runParams(opts& oo,
 
   double stop = sstmacWallTime();
   stats.wallTime = stop - start;
+  stats.runTime = finish_start - start;
+  stats.finishTime = stop - finish_start;
   stats.simulatedTime = runtime.sec();
 
   sstmac::Runtime::deleteStatics();
@@ -284,6 +303,66 @@ run(SSTMAC_MAYBE_UNUSED opts&  oo,
 #endif
 }
 
+#if !SSTMAC_INTEGRATED_SST_CORE
+void
+writeSimStats(const std::string& fname, ParallelRuntime* rt, SimStats& stats)
+{
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  stats.peakRssKB = usage.ru_maxrss;
+  stats.params = sprockit::SimParameters::stats();
+
+  int nproc = 1;
+  if (rt){
+    //events are summed across ranks, timings and memory report the slowest/largest rank
+    nproc = rt->nproc();
+    stats.numEvents = rt->globalSum(stats.numEvents);
+    stats.params.lookups = rt->globalSum(stats.params.lookups);
+    stats.params.misses = rt->globalSum(stats.params.misses);
+    stats.params.parses = rt->globalSum(stats.params.parses);
+    stats.params.cacheHits = rt->globalSum(stats.params.cacheHits);
+    stats.peakRssKB = rt->globalMax(int64_t(stats.peakRssKB));
+    auto maxTime = [rt](double t){ return rt->allreduceMax(int64_t(t*1e6)) * 1e-6; };
+    stats.paramsTime = maxTime(stats.paramsTime);
+    stats.setupTime = maxTime(stats.setupTime);
+    stats.runTime = maxTime(stats.runTime);
+    stats.finishTime = maxTime(stats.finishTime);
+    if (rt->me() != 0) return;
+  }
+
+  nlohmann::json js;
+  js["nproc"] = nproc;
+  js["simulated_time"] = stats.simulatedTime;
+  js["events"] = stats.numEvents;
+  js["events_per_sec"] = stats.runTime > 0 ? stats.numEvents / stats.runTime : 0.;
+  js["wall_per_sim_sec"] = stats.simulatedTime > 0 ? stats.runTime / stats.simulatedTime : 0.;
+  js["peak_rss_kb"] = stats.peakRssKB;
+  js["phases"]["params"] = stats.paramsTime;
+  js["phases"]["setup"] = stats.setupTime;
+  js["phases"]["run"] = stats.runTime;
+  js["phases"]["finish"] = stats.finishTime;
+  js["params"]["lookups"] = stats.params.lookups;
+  js["params"]["misses"] = stats.params.misses;
+  js["params"]["parses"] = stats.params.parses;
+  js["params"]["cache_hits"] = stats.params.cacheHits;
+  js["lazy_compute"]["calls"] = stats.lazyComputeCalls;
+  js["lazy_compute"]["flushes"] = stats.lazyComputeFlushes;
+  js["compute_cache"]["hits"] = stats.computeCacheHits;
+  js["compute_cache"]["misses"] = stats.computeCacheMisses;
+  js["compute_cache"]["contended"] = stats.computeCacheContended;
+  sprockit::ObjectPoolRegistry::forEach([&](const sprockit::ObjectPoolStats& pool){
+    js["pools"][pool.name]["live"] = pool.live->load();
+    js["pools"][pool.name]["capacity"] = pool.capacity;
+  });
+
+  std::ofstream ofs(fname.c_str());
+  if (!ofs.good()){
+    spkt_abort_printf("unable to open sim stats file %s", fname.c_str());
+  }
+  ofs << js.dump(2) << std::endl;
+}
+#endif
+
 int
 tryMain(sprockit::SimParameters::ptr params,
         int argc, char **argv, bool params_only)
@@ -301,6 +380,7 @@ tryMain(sprockit::SimParameters::ptr params,
 
   opts oo;
   SimStats stats;
+  double params_start = sstmacWallTime();
   sstmac::initOpts(oo, argc, argv);
 
   bool parallel = rt && rt->nproc() > 1;
@@ -308,6 +388,7 @@ tryMain(sprockit::SimParameters::ptr params,
 
   //do some cleanup and processing of params
   sstmac::remapParams(params);
+  stats.paramsTime = sstmacWallTime() - params_start;
 
   if (params->hasParam("external_libs")){
     std::string pathStr = loadExternPathStr();
@@ -343,6 +424,20 @@ tryMain(sprockit::SimParameters::ptr params,
     cout0 << sprockit::sprintf("Estimated total runtime of %20.8f seconds\n", stats.simulatedTime);
   }
 
+  if (stats.lazyComputeCalls){
+    cout0 << sprockit::sprintf("Lazy compute merged %" PRIu64 " compute calls into %" PRIu64 " blocks\n",
+                               stats.lazyComputeCalls, stats.lazyComputeFlushes);
+  }
+
+  uint64_t cache_lookups = stats.computeCacheHits + stats.computeCacheMisses;
+  if (cache_lookups){
+    cout0 << sprockit::sprintf("Compute cache hit %" PRIu64 " of %" PRIu64 " uncontended blocks (%.1f%%), "
+                               "%" PRIu64 " contended blocks used the memory model\n",
+                               stats.computeCacheHits, cache_lookups,
+                               100.0 * stats.computeCacheHits / cache_lookups,
+                               stats.computeCacheContended);
+  }
+
   if (oo.print_params) {
     params->printParams();
   }
@@ -362,6 +457,10 @@ tryMain(sprockit::SimParameters::ptr params,
     ofs.close();
   }
 
+  if (!oo.sim_stats_file.empty()){
+    writeSimStats(oo.sim_stats_file, rt, stats);
+  }
+
   sstmac::finalize(rt);
 #endif
   if (oo.use_app_rc){
@@ -72,6 +72,7 @@ struct opts {
   std::string outputGraphviz;
   std::string outputXYZ;
   std::string params_dump_file;
+  std::string sim_stats_file;
 
   opts() :
     help(0),
@@ -96,10 +97,33 @@ struct SimStats {
   double wallTime;
   double simulatedTime;
   int numResults;
+  uint64_t numEvents;
+  double paramsTime;
+  double setupTime;
+  double runTime;
+  double finishTime;
+  long peakRssKB;
+  uint64_t lazyComputeCalls;
+  uint64_t lazyComputeFlushes;
+  uint64_t computeCacheHits;
+  uint64_t computeCacheMisses;
+  uint64_t computeCacheContended;
+  sprockit::ParamStats params;
   SimStats() :
     wallTime(0), 
     simulatedTime(0), 
-    numResults(-1) 
+    numResults(-1),
+    numEvents(0),
+    paramsTime(0),
+    setupTime(0),
+    runTime(0),
+    finishTime(0),
+    peakRssKB(0),
+    lazyComputeCalls(0),
+    lazyComputeFlushes(0),
+    computeCacheHits(0),
+    computeCacheMisses(0),
+    computeCacheContended(0)
   {}
 };
 
@@ -161,6 +185,12 @@ void runParams(opts& oo,
 void initFirstRun(ParallelRuntime* rt,
     SST::Params& params);
 
+/**
+ * Write simulator throughput (events, events/sec, per-phase wall time, peak RSS)
+ * as JSON to the given file. Collective over all ranks, only rank 0 writes.
+ */
+void writeSimStats(const std::string& fname, ParallelRuntime* rt, SimStats& stats);
+
 }
 
 #endif
@@ -45,6 +45,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/util.h>
 #include <sstmac/software/process/operating_system.h>
 #include <sstmac/software/process/app.h>
+#include <sstmac/software/process/iteration_sampler.h>
 #include <cstring>
 #include <sstmac/null_buffer.h>
 
@@ -53,6 +54,7 @@ typedef int (*empty_main_fxn)();
 
 extern "C" double
 sstmac_now(){
+  sstmac::sw::OperatingSystem::currentThread()->flushCompute();
   return sstmac::sw::OperatingSystem::currentOs()->now().sec();
 }
 
@@ -216,6 +218,38 @@ void sstmac_advance_time(const char* param_name)
   parent->compute(iter->second);
 }
 
+extern "C"
+int sstmac_sample_iteration(const char* loop_id, int detail, int skip, int resample, double tolerance)
+{
+  sstmac::sw::Thread* thr = sstmac::sw::OperatingSystem::currentThread();
+  sstmac::sw::App* parent = thr->parentApp();
+  sstmac::sw::IterationSampler* sampler =
+      parent->iterationSampler(loop_id, detail, skip, resample, tolerance);
+  sstmac::TimeDelta charge;
+  if (sampler->beginIteration(thr->now(), charge)){
+    return 1;
+  } else {
+    parent->compute(charge);
+    return 0;
+  }
+}
+
+extern "C"
+void sstmac_sample_loop_begin(const char* loop_id)
+{
+  sstmac::sw::Thread* thr = sstmac::sw::OperatingSystem::currentThread();
+  sstmac::sw::IterationSampler* sampler = thr->parentApp()->findIterationSampler(loop_id);
+  if (sampler) sampler->beginLoop();
+}
+
+extern "C"
+void sstmac_sample_loop_end(const char* loop_id)
+{
+  sstmac::sw::Thread* thr = sstmac::sw::OperatingSystem::currentThread();
+  sstmac::sw::IterationSampler* sampler = thr->parentApp()->findIterationSampler(loop_id);
+  if (sampler) sampler->endLoop(thr->now());
+}
+
 int
 userSkeletonMainInitFxn(const char* name, main_fxn fxn)
 {
@@ -55,6 +55,6 @@ RegisterKeywords(
   { "arbitrator", "" },
   { "debug_startup", "whether debug printing should be active on startup" },
   { "debug", "" },
-  { "timestamp_resolution", "the length of time corresponding to a single tick" },
+  { "timestamp_resolution", "the length of time corresponding to a single tick, 100as by default" },
   { "stop_time", "the time a simulation should terminate" },
 );
@@ -234,6 +234,9 @@ extern char* static_init_tls_segment;
 void sstmac_init_global_space(void* ptr, int size, int offset, bool tls);
 void sstmac_advance_time(const char* param_name);
 void sstmac_blocking_call(int condition, double timeout, const char* api);
+int sstmac_sample_iteration(const char* loop_id, int detail, int skip, int resample, double tolerance);
+void sstmac_sample_loop_begin(const char* loop_id);
+void sstmac_sample_loop_end(const char* loop_id);
 
 #ifdef __cplusplus
 }
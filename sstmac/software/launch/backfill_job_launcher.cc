@@ -0,0 +1,401 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+
+#include <sstmac/software/launch/backfill_job_launcher.h>
+#include <sstmac/software/launch/launch_request.h>
+#include <sstmac/software/launch/launch_event.h>
+#include <sstmac/software/process/operating_system.h>
+#include <sstmac/software/process/app.h>
+#include <sstmac/common/event_callback.h>
+#include <sstmac/hardware/node/node.h>
+#include <sstmac/hardware/topology/topology.h>
+#include <sprockit/keyword_registration.h>
+#include <sprockit/fileio.h>
+#include <sprockit/output.h>
+#include <sprockit/util.h>
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+RegisterKeywords(
+{ "job_trace", "a job trace in the Standard Workload Format (SWF) to replay" },
+{ "job_templates", "the list of app namespaces used to run trace jobs, chosen by the SWF application number" },
+{ "default_walltime", "the walltime estimate for jobs that do not give one, an hour by default" },
+{ "backfill", "whether later jobs may start ahead of a blocked job without delaying it" },
+{ "walltime", "the walltime estimate of a job used for backfill reservations" },
+{ "trace_runtime", "the run time recorded in the job trace, trace_job apps run for this long" },
+);
+
+namespace sstmac {
+namespace sw {
+
+BackfillJoblauncher::BackfillJoblauncher(SST::Params& params, OperatingSystem* os) :
+  JobLauncher(params, os),
+  next_aid_(1),
+  num_started_(0),
+  num_backfilled_(0),
+  total_wait_(0)
+{
+  //free nodes live in the bitset, not the ordered set
+  available_.clear();
+  free_.resize(topology_->numNodes(), true);
+
+  default_walltime_ = params.find<SST::UnitAlgebra>("default_walltime", "3600s").getValue().toDouble();
+  backfill_ = params.find<bool>("backfill", true);
+
+  for (AppLaunchRequest* req : initial_requests_){
+    next_aid_ = std::max(next_aid_, int(req->aid()) + 1);
+  }
+
+  if (params.contains("job_templates")){
+    std::vector<std::string> names;
+    params.find_array("job_templates", names);
+    for (std::string& name : names){
+      JobTemplate templ;
+      templ.name = name;
+      templ.params = params.get_scoped_params(name);
+      if (templ.params.contains("launch_cmd")){
+        spkt_abort_printf("job template %s cannot give a launch_cmd - "
+                          "trace jobs set their own size, use tasks_per_node instead",
+                          name.c_str());
+      }
+      templ.procsPerNode = templ.params.find<int>("tasks_per_node", 1);
+      templates_.push_back(templ);
+    }
+  }
+
+  if (params.contains("job_trace")){
+    if (templates_.empty()){
+      spkt_abort_printf("job_trace given without any job_templates to run the jobs");
+    }
+    readTrace(params.find<std::string>("job_trace"), params);
+  }
+}
+
+BackfillJoblauncher::~BackfillJoblauncher()
+{
+  for (QueuedJob& job : queue_){
+    if (job.request) delete job.request;
+  }
+  if (num_started_){
+    cout0 << sprockit::sprintf("Backfill launcher: started %llu jobs (%llu backfilled), "
+                               "mean wait %12.4fs, %d jobs still queued\n",
+                               (unsigned long long) num_started_,
+                               (unsigned long long) num_backfilled_,
+                               total_wait_ / num_started_, int(queue_.size()));
+  }
+}
+
+void
+BackfillJoblauncher::readTrace(const std::string& fname, SST::Params&  /*params*/)
+{
+  std::ifstream in;
+  sprockit::SpktFileIO::openFile(in, fname);
+  if (!in.is_open()){
+    spkt_abort_printf("could not open job trace %s", fname.c_str());
+  }
+
+  //SWF fields (1-based): 2 submit, 4 run time, 5 allocated procs,
+  //8 requested procs, 9 requested time, 14 application number
+  int num_dropped = 0;
+  std::string line;
+  while (std::getline(in, line)){
+    size_t start = line.find_first_not_of(" \t");
+    if (start == std::string::npos || line[start] == ';') continue;
+
+    std::istringstream sstr(line);
+    double fields[18];
+    int num_fields = 0;
+    while (num_fields < 18 && sstr >> fields[num_fields]) ++num_fields;
+    if (num_fields < 9){
+      spkt_abort_printf("malformed line in job trace %s: %s", fname.c_str(), line.c_str());
+    }
+
+    TraceJob job;
+    job.submit = fields[1];
+    job.nproc = fields[7] > 0 ? fields[7] : fields[4];
+    job.runtime = fields[3];
+    job.estimate = fields[8] > 0 ? fields[8] : job.runtime;
+    if (job.estimate <= 0) job.estimate = default_walltime_;
+    if (job.runtime < 0) job.runtime = job.estimate;
+    int app = num_fields > 13 && fields[13] >= 0 ? fields[13] : 0;
+    job.templ = app % templates_.size();
+
+    int ppn = templates_[job.templ].procsPerNode;
+    int nodes = (job.nproc + ppn - 1) / ppn;
+    if (job.nproc <= 0 || job.submit < 0 || nodes > free_.numNodes()){
+      //cancelled jobs or jobs larger than the simulated machine
+      ++num_dropped;
+      continue;
+    }
+    //estimates are only compared as seconds, but jobs are submitted and run in simulated time
+    double max_time = std::max(job.submit, job.runtime);
+    if (max_time > TimeDelta::maxTime()){
+      spkt_abort_printf("job trace %s has a job at %.0fs running for %.0fs, longer than the %.0fs "
+                        "the timestamp_resolution of %s can hold - use a coarser timestamp_resolution",
+                        fname.c_str(), job.submit, job.runtime, TimeDelta::maxTime(),
+                        TimeDelta::tickIntervalString().c_str());
+    }
+    trace_.push_back(job);
+  }
+
+  std::stable_sort(trace_.begin(), trace_.end(),
+                   [](const TraceJob& a, const TraceJob& b){ return a.submit < b.submit; });
+
+  if (num_dropped){
+    cerr0 << sprockit::sprintf("WARNING: dropped %d jobs from trace %s that were cancelled "
+                               "or larger than the %d simulated nodes\n",
+                               num_dropped, fname.c_str(), free_.numNodes());
+  }
+}
+
+void
+BackfillJoblauncher::scheduleLaunchRequests()
+{
+  JobLauncher::scheduleLaunchRequests();
+  if (trace_.empty()) return;
+
+  for (int i=0; i < trace_.size(); ++i){
+    os_->incrementAppRefcount();
+  }
+  //only the next submission is ever pending in the event queue
+  auto ev = newCallback(this, &BackfillJoblauncher::submitTraceJobs, 0);
+  os_->sendExecutionEvent(Timestamp(trace_[0].submit), ev);
+}
+
+void
+BackfillJoblauncher::submitTraceJobs(int first)
+{
+  double submit = trace_[first].submit;
+  int idx = first;
+  for (; idx < trace_.size() && trace_[idx].submit == submit; ++idx){
+    const TraceJob& tj = trace_[idx];
+    int ppn = templates_[tj.templ].procsPerNode;
+    QueuedJob job;
+    job.aid = next_aid_++;
+    job.nodes = (tj.nproc + ppn - 1) / ppn;
+    job.submit = os_->now().sec();
+    job.estimate = tj.estimate;
+    job.request = nullptr;
+    job.traceIdx = idx;
+    queue_.push_back(job);
+  }
+  schedule();
+
+  if (idx < trace_.size()){
+    auto ev = newCallback(this, &BackfillJoblauncher::submitTraceJobs, idx);
+    os_->sendExecutionEvent(Timestamp(trace_[idx].submit), ev);
+  }
+}
+
+bool
+BackfillJoblauncher::handleLaunchRequest(AppLaunchRequest* request,
+                                         ordered_node_set&  /*allocation*/)
+{
+  int nodes = request->numNodes();
+  if (nodes > free_.numNodes()){
+    spkt_abort_printf("app %d requests %d nodes, but the machine only has %d",
+                      request->aid(), nodes, free_.numNodes());
+  }
+
+  SST::Params app_params = request->appParams();
+  QueuedJob job;
+  job.aid = request->aid();
+  job.nodes = nodes;
+  job.submit = os_->now().sec();
+  if (app_params.contains("walltime")){
+    job.estimate = app_params.find<SST::UnitAlgebra>("walltime").getValue().toDouble();
+  } else {
+    job.estimate = default_walltime_;
+  }
+  job.request = request;
+  job.traceIdx = -1;
+  queue_.push_back(job);
+  schedule();
+  //schedule() launches the job itself when it fits
+  return false;
+}
+
+AppLaunchRequest*
+BackfillJoblauncher::buildRequest(const QueuedJob& job)
+{
+  const TraceJob& tj = trace_[job.traceIdx];
+  SST::Params job_params;
+  job_params.insert(templates_[tj.templ].params);
+  if (!job_params.contains("name")){
+    job_params.insert("name", "trace_job");
+  }
+  job_params.insert("size", std::to_string(tj.nproc));
+  job_params.insert("trace_runtime", sprockit::sprintf("%.9fs", tj.runtime));
+  App::lockDlopen(job.aid);
+  return new AppLaunchRequest(job_params, job.aid, sprockit::sprintf("job%d", int(job.aid)));
+}
+
+bool
+BackfillJoblauncher::tryStart(QueuedJob& job)
+{
+  if (job.nodes > free_.size()) return false;
+
+  if (!job.request){
+    job.request = buildRequest(job);
+  }
+
+  ordered_node_set allocation;
+  if (job.request->allocationName() == "first_available"){
+    free_.takeFirst(job.nodes, allocation);
+  } else {
+    //topology-aware placement goes through the allocator plugin
+    ordered_node_set available = free_.toSet();
+    if (!job.request->requestAllocation(available, allocation)){
+      return false;
+    }
+    for (NodeId nid : allocation){
+      if (!free_.contains(nid)) return false; //the allocator wants busy nodes, wait
+    }
+    for (NodeId nid : allocation){
+      free_.erase(nid);
+    }
+  }
+
+  double now = os_->now().sec();
+  running_[job.aid] = std::make_pair(now + job.estimate, int(allocation.size()));
+  total_wait_ += now - job.submit;
+  ++num_started_;
+
+  node_debug("backfill launcher starting job %d on %d nodes after waiting %12.8fs",
+             int(job.aid), int(allocation.size()), now - job.submit);
+
+  satisfyLaunchRequest(job.request, allocation);
+  job.request = nullptr;
+  return true;
+}
+
+void
+BackfillJoblauncher::schedule()
+{
+  //first come, first served as long as jobs fit
+  while (!queue_.empty() && tryStart(queue_.front())){
+    queue_.pop_front();
+  }
+  if (queue_.empty() || !backfill_ || free_.size() == 0) return;
+
+  //EASY backfill: find the earliest time the blocked head job can start
+  //based on the walltime estimates of running jobs - the shadow time
+  double now = os_->now().sec();
+  std::vector<std::pair<double,int>> ends;
+  ends.reserve(running_.size());
+  for (auto& pair : running_){
+    //jobs past their estimate are assumed to end any moment
+    ends.push_back(std::make_pair(std::max(pair.second.first, now), pair.second.second));
+  }
+  std::sort(ends.begin(), ends.end());
+
+  int head_nodes = queue_.front().nodes;
+  int avail = free_.size();
+  double shadow = std::numeric_limits<double>::max();
+  for (auto& end : ends){
+    avail += end.second;
+    if (avail >= head_nodes){
+      shadow = end.first;
+      break;
+    }
+  }
+  //nodes free at the shadow time that the head job does not need
+  int extra = std::max(0, avail - head_nodes);
+
+  auto iter = queue_.begin();
+  ++iter;
+  while (iter != queue_.end() && free_.size() > 0){
+    QueuedJob& job = *iter;
+    bool ends_before_shadow = now + job.estimate <= shadow;
+    if (job.nodes <= free_.size() && (ends_before_shadow || job.nodes <= extra)){
+      if (tryStart(job)){
+        if (!ends_before_shadow) extra -= job.nodes;
+        ++num_backfilled_;
+        iter = queue_.erase(iter);
+        continue;
+      }
+    }
+    ++iter;
+  }
+}
+
+void
+BackfillJoblauncher::stopEventReceived(JobStopRequest* ev)
+{
+  running_.erase(ev->aid());
+  schedule();
+  os_->decrementAppRefcount();
+}
+
+void
+BackfillJoblauncher::releaseNodes(const std::vector<NodeId>& rank_to_node)
+{
+  for (NodeId nid : rank_to_node){
+    free_.insert(nid);
+  }
+}
+
+TraceJobApp::TraceJobApp(SST::Params& params, SoftwareId sid, OperatingSystem* os) :
+  App(params, sid, os)
+{
+  runtime_ = params.find<SST::UnitAlgebra>("trace_runtime", "0s").getValue().toDouble();
+}
+
+int
+TraceJobApp::skeletonMain()
+{
+  if (now().sec() + runtime_ > TimeDelta::maxTime()){
+    spkt_abort_printf("trace job %d would run past the %.0fs the timestamp_resolution of %s can hold - "
+                      "use a coarser timestamp_resolution", int(aid()), TimeDelta::maxTime(),
+                      TimeDelta::tickIntervalString().c_str());
+  }
+  compute(TimeDelta(runtime_));
+  return 0;
+}
+
+}
+}
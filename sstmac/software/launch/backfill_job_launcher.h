@@ -0,0 +1,193 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+
+#ifndef sstmac_software_launch_BACKFILL_JOB_LAUNCHER_H
+#define sstmac_software_launch_BACKFILL_JOB_LAUNCHER_H
+
+#include <sstmac/software/launch/job_launcher.h>
+#include <sstmac/software/launch/node_set.h>
+#include <sstmac/software/process/app.h>
+#include <list>
+#include <map>
+#include <vector>
+
+namespace sstmac {
+namespace sw {
+
+/**
+ * @brief The BackfillJoblauncher class
+ * A batch scheduler for simulating a stream of jobs, e.g. weeks of a production job mix.
+ * Jobs come from the usual app1, app2, ... requests and optionally from a job trace
+ * in the Standard Workload Format (SWF). Jobs start in submission order as long as
+ * they fit. When the job at the head of the queue does not fit, EASY backfill
+ * reserves the earliest time it can start based on the walltime estimates of the
+ * running jobs. Later jobs can jump ahead only if they do not delay that reservation.
+ *
+ * Trace jobs run the trace_job app unless their template names another app. It holds
+ * every rank for the run time recorded in the trace, given to the app as trace_runtime.
+ * Submit times and walltime estimates stay in seconds, so a trace can span more time
+ * than the time resolution holds as long as each job's own times fit.
+ *
+ * Free nodes are kept in a bitset. The default first_available allocation is served
+ * straight from the bitset. Any other allocation strategy (topology-aware placement)
+ * goes through the regular NodeAllocator plugin, and ranks are placed by the TaskMapper
+ * plugins as for any other launcher. Trace jobs are only turned into launch requests
+ * when they start, so queued jobs carry no parameters, and no node holds state for a job
+ * that has not landed on it.
+ */
+class BackfillJoblauncher : public JobLauncher
+{
+ public:
+  SST_ELI_REGISTER_DERIVED(
+    JobLauncher,
+    BackfillJoblauncher,
+    "macro",
+    "backfill",
+    SST_ELI_ELEMENT_VERSION(1,0,0),
+    "a trace-driven batch scheduler with EASY backfill")
+
+  BackfillJoblauncher(SST::Params& params, OperatingSystem* os);
+
+  ~BackfillJoblauncher() override;
+
+  void scheduleLaunchRequests() override;
+
+ private:
+  /** A job read from the trace, kept compact until it is submitted */
+  struct TraceJob {
+    double submit;
+    double runtime;
+    double estimate;
+    int nproc;
+    int templ;
+  };
+
+  struct QueuedJob {
+    AppId aid;
+    int nodes;
+    /** The submit time in seconds */
+    double submit;
+    /** The walltime estimate in seconds */
+    double estimate;
+    /** The launch request, null for trace jobs until they start */
+    AppLaunchRequest* request;
+    /** The index of the trace job, -1 for app requests */
+    int traceIdx;
+  };
+
+  struct JobTemplate {
+    std::string name;
+    SST::Params params;
+    int procsPerNode;
+  };
+
+  bool handleLaunchRequest(AppLaunchRequest* request, ordered_node_set& allocation) override;
+
+  void stopEventReceived(JobStopRequest* ev) override;
+
+  void releaseNodes(const std::vector<NodeId>& rank_to_node) override;
+
+  void readTrace(const std::string& fname, SST::Params& params);
+
+  void submitTraceJobs(int first);
+
+  /**
+   * Start queued jobs in order while they fit, then backfill around the head of the queue
+   */
+  void schedule();
+
+  bool tryStart(QueuedJob& job);
+
+  AppLaunchRequest* buildRequest(const QueuedJob& job);
+
+  NodeBitset free_;
+
+  std::list<QueuedJob> queue_;
+
+  /** For each running job, its estimated end in seconds and its number of nodes */
+  std::map<AppId, std::pair<double,int>> running_;
+
+  std::vector<TraceJob> trace_;
+
+  std::vector<JobTemplate> templates_;
+
+  double default_walltime_;
+
+  bool backfill_;
+
+  int next_aid_;
+
+  uint64_t num_started_;
+  uint64_t num_backfilled_;
+  double total_wait_;
+
+};
+
+/**
+ * The default app of trace jobs, every rank computes for the run time recorded in the trace
+ */
+class TraceJobApp : public App
+{
+ public:
+  SST_ELI_REGISTER_DERIVED(
+    App,
+    TraceJobApp,
+    "macro",
+    "trace_job",
+    SST_ELI_ELEMENT_VERSION(1,0,0),
+    "replays a job from a job trace by running for its recorded time")
+
+  TraceJobApp(SST::Params& params, SoftwareId sid, OperatingSystem* os);
+
+  int skeletonMain() override;
+
+ private:
+  double runtime_;
+};
+
+}
+}
+
+#endif
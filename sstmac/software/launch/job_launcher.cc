@@ -168,19 +168,22 @@ JobLauncher::cleanupApp(JobStopRequest* ev)
 
   TaskMapping::ptr themap = TaskMapping::globalMapping(ev->aid());
   TaskMapping::removeGlobalMapping(ev->aid(), ev->uniqueName());
-  const std::vector<NodeId>& rank_to_node = themap->rankToNode();
-  int num_ranks = rank_to_node.size();
-  //put all the nodes back in the available map
-  for (int i=0; i < num_ranks; ++i){
-    NodeId nid = rank_to_node[i];
-    available_.insert(nid);
-  }
+  releaseNodes(themap->rankToNode());
 
   if (terminators_.find(ev->aid()) != terminators_.end()){
     os_->endSimulation();
   }
 }
 
+void
+JobLauncher::releaseNodes(const std::vector<NodeId>& rank_to_node)
+{
+  //put all the nodes back in the available map
+  for (NodeId nid : rank_to_node){
+    available_.insert(nid);
+  }
+}
+
 void
 JobLauncher::satisfyLaunchRequest(AppLaunchRequest* request, const ordered_node_set& allocation)
 {
@@ -102,7 +102,7 @@ class JobLauncher : public Service
 
   void incomingLaunchRequest(AppLaunchRequest* request);
 
-  void scheduleLaunchRequests();
+  virtual void scheduleLaunchRequests();
 
   ~JobLauncher() override{}
 
@@ -117,15 +117,6 @@ class JobLauncher : public Service
   std::list<AppLaunchRequest*> initial_requests_;
   std::set<int> terminators_;
 
- private:
-  void addLaunchRequests(SST::Params& params);
-
-  /**
-   * @brief cleanup_app Perform all operations to free up resources associated with a job
-   * @param ev
-   */
-  void cleanupApp(JobStopRequest* ev);
-
   /**
    * @brief satisfy_launch_request Called by subclasses to cause a job to be launched
    *                This sends out launch messages to all the nodes involved, which will
@@ -136,6 +127,21 @@ class JobLauncher : public Service
    */
   void satisfyLaunchRequest(AppLaunchRequest* request, const ordered_node_set& allocation);
 
+  /**
+   * @brief releaseNodes Return the nodes of a finished job to the free pool
+   * @param rank_to_node The node of each rank in the job, nodes may repeat
+   */
+  virtual void releaseNodes(const std::vector<NodeId>& rank_to_node);
+
+ private:
+  void addLaunchRequests(SST::Params& params);
+
+  /**
+   * @brief cleanup_app Perform all operations to free up resources associated with a job
+   * @param ev
+   */
+  void cleanupApp(JobStopRequest* ev);
+
   /**
    * @brief handle_new_launch_request As if a new job had been submitted with qsub or salloc.
    * The JobLauncher receives a new request to launch an application, at which point
@@ -94,8 +94,9 @@ SoftwareLaunchRequest::SoftwareLaunchRequest(SST::Params& params) :
     procs_per_node_ = params.find<int>("tasks_per_node", 1);
   }
 
+  allocation_name_ = params.find<std::string>("allocation", "first_available");
   allocator_ = sprockit::create<sw::NodeAllocator>(
-     "macro", params.find<std::string>("allocation", "first_available"), params);
+     "macro", allocation_name_, params);
 
   indexer_ = sprockit::create<sw::TaskMapper>(
      "macro", params.find<std::string>("indexing", "block"), params);
@@ -165,17 +166,23 @@ SoftwareLaunchRequest::indexAllocation(
   indexed_ = true;
 }
 
-bool
-SoftwareLaunchRequest::requestAllocation(
-  const sw::ordered_node_set& available,
-  sw::ordered_node_set& allocation)
+int
+SoftwareLaunchRequest::numNodes() const
 {
   int num_nodes = nproc_ / procs_per_node_;
   int remainder = nproc_ % procs_per_node_;
   if (remainder) {
     ++num_nodes;
   }
-  return allocator_->allocate(num_nodes, available, allocation);
+  return num_nodes;
+}
+
+bool
+SoftwareLaunchRequest::requestAllocation(
+  const sw::ordered_node_set& available,
+  sw::ordered_node_set& allocation)
+{
+  return allocator_->allocate(numNodes(), available, allocation);
 }
 
 void
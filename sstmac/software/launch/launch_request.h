@@ -81,6 +81,18 @@ class SoftwareLaunchRequest
     return nproc_;
   }
 
+  /**
+   * @return The number of nodes needed to run nproc tasks at procs_per_node
+   */
+  int numNodes() const;
+
+  /**
+   * @return The name of the node allocation strategy
+   */
+  const std::string& allocationName() const {
+    return allocation_name_;
+  }
+
   Timestamp time() const {
     return time_;
   }
@@ -132,6 +144,7 @@ class SoftwareLaunchRequest
  private:
   sw::NodeAllocator* allocator_;
   sw::TaskMapper* indexer_;
+  std::string allocation_name_;
   std::vector<int> core_affinities_;
 
   bool indexed_;
@@ -46,6 +46,8 @@ Questions? Contact sst-macro-help@sandia.gov
 #define NODE_SET_H
 
 #include <set>
+#include <vector>
+#include <cstdint>
 #include <sstmac/common/node_address.h>
 
 namespace sstmac {
@@ -53,6 +55,103 @@ namespace sw {
 
 typedef std::set<NodeId> ordered_node_set;
 
+/**
+ * A dense set of node IDs kept as a bitset. Insert, erase and lookup are O(1)
+ * and scans for free nodes cover 64 nodes per word, which keeps allocation cheap
+ * for launchers that cycle thousands of jobs through a large machine.
+ */
+class NodeBitset {
+ public:
+  NodeBitset() : num_nodes_(0), count_(0) {}
+
+  /**
+   * @param num_nodes The number of nodes in the machine
+   * @param full Whether all nodes start in the set
+   */
+  void resize(int num_nodes, bool full){
+    num_nodes_ = num_nodes;
+    words_.assign((num_nodes + 63) / 64, full ? ~uint64_t(0) : uint64_t(0));
+    count_ = full ? num_nodes : 0;
+    int rem = num_nodes % 64;
+    if (full && rem){
+      words_.back() = (uint64_t(1) << rem) - 1;
+    }
+  }
+
+  bool contains(NodeId nid) const {
+    return words_[nid / 64] & (uint64_t(1) << (nid % 64));
+  }
+
+  void insert(NodeId nid){
+    uint64_t bit = uint64_t(1) << (nid % 64);
+    uint64_t& word = words_[nid / 64];
+    if (!(word & bit)){
+      word |= bit;
+      ++count_;
+    }
+  }
+
+  void erase(NodeId nid){
+    uint64_t bit = uint64_t(1) << (nid % 64);
+    uint64_t& word = words_[nid / 64];
+    if (word & bit){
+      word &= ~bit;
+      --count_;
+    }
+  }
+
+  /**
+   * @return The number of nodes in the set
+   */
+  int size() const {
+    return count_;
+  }
+
+  int numNodes() const {
+    return num_nodes_;
+  }
+
+  /**
+   * Move the n lowest numbered nodes out of the set
+   * @param n The number of nodes to take
+   * @param taken [OUT] The nodes removed from the set
+   * @return Whether there were at least n nodes, nothing is taken if not
+   */
+  bool takeFirst(int n, ordered_node_set& taken){
+    if (n > count_) return false;
+    for (int w=0; w < words_.size() && n > 0; ++w){
+      uint64_t& word = words_[w];
+      while (word && n > 0){
+        int bit = __builtin_ctzll(word);
+        taken.insert(taken.end(), NodeId(w*64 + bit));
+        word &= word - 1;
+        --count_;
+        --n;
+      }
+    }
+    return true;
+  }
+
+  ordered_node_set toSet() const {
+    ordered_node_set ret;
+    for (int w=0; w < words_.size(); ++w){
+      uint64_t word = words_[w];
+      while (word){
+        int bit = __builtin_ctzll(word);
+        ret.insert(ret.end(), NodeId(w*64 + bit));
+        word &= word - 1;
+      }
+    }
+    return ret;
+  }
+
+ private:
+  std::vector<uint64_t> words_;
+  int num_nodes_;
+  int count_;
+
+};
+
 }
 }
 
@@ -55,8 +55,26 @@ using sstmac::TimeDelta;
 using sstmac::Timestamp;
 using os = sstmac::sw::OperatingSystem;
 
+namespace {
+
+/** Marks compute issued directly by the application, the only kind lazy compute can defer */
+struct AppComputeScope {
+  AppComputeScope() : thr(os::currentThread()) {
+    thr->setAppCompute(true);
+  }
+
+  ~AppComputeScope(){
+    thr->setAppCompute(false);
+  }
+
+  sstmac::sw::Thread* thr;
+};
+
+}
+
 extern "C" double sstmac_block()
 {
+  os::currentThread()->flushCompute();
   os::currentOs()->block();
   return os::currentOs()->now().sec();
 }
@@ -92,37 +110,45 @@ extern "C" int sstmac_fsleep(double secs){
 }
 
 extern "C" void sstmac_compute(double secs){
-  sstmac::sw::OperatingSystem::currentOs()->compute(TimeDelta(secs));
+  if (!os::currentThread()->accumulateCompute(TimeDelta(secs))){
+    os::currentOs()->compute(TimeDelta(secs));
+  }
 }
 
 extern "C" void sstmac_memread(uint64_t bytes){
+  AppComputeScope scope;
   sstmac::sw::OperatingSystem::currentThread()->parentApp()
     ->computeBlockRead(bytes);
 }
 
 extern "C" void sstmac_memwrite(uint64_t bytes){
+  AppComputeScope scope;
   sstmac::sw::OperatingSystem::currentThread()->parentApp()
     ->computeBlockWrite(bytes);
 }
 
 extern "C" void sstmac_memcopy(uint64_t bytes){
+  AppComputeScope scope;
   sstmac::sw::OperatingSystem::currentThread()->parentApp()
     ->computeBlockMemcpy(bytes);
 }
 
 extern "C" void sstmac_compute_detailed(uint64_t nflops, uint64_t nintops, uint64_t bytes){
+  AppComputeScope scope;
   sstmac::sw::OperatingSystem::currentThread()
     ->computeDetailed(nflops, nintops, bytes);
 }
 
 extern "C" void sstmac_compute_detailed_nthr(uint64_t nflops, uint64_t nintops, uint64_t bytes,
                                         int nthread){
+  AppComputeScope scope;
   sstmac::sw::OperatingSystem::currentThread()
     ->computeDetailed(nflops, nintops, bytes, nthread);
 }
 
 extern "C" void sstmac_computeLoop(uint64_t num_loops, uint32_t nflops_per_loop,
                     uint32_t nintops_per_loop, uint32_t bytes_per_loop){
+  AppComputeScope scope;
   sstmac::sw::OperatingSystem::currentThread()->parentApp()
     ->computeLoop(num_loops, nflops_per_loop, nintops_per_loop, bytes_per_loop);
 }
@@ -130,6 +156,7 @@ extern "C" void sstmac_computeLoop(uint64_t num_loops, uint32_t nflops_per_loop,
 extern "C" void sstmac_compute_loop2(uint64_t isize, uint64_t jsize,
                     uint32_t nflops_per_loop,
                     uint32_t nintops_per_loop, uint32_t bytes_per_loop){
+  AppComputeScope scope;
   uint64_t num_loops = isize * jsize;
   sstmac::sw::OperatingSystem::currentThread()->parentApp()
     ->computeLoop(num_loops, nflops_per_loop, nintops_per_loop, bytes_per_loop);
@@ -140,6 +167,7 @@ sstmac_compute_loop3(uint64_t isize, uint64_t jsize, uint64_t ksize,
                     uint32_t nflops_per_loop,
                     uint32_t nintops_per_loop,
                     uint32_t bytes_per_loop){
+  AppComputeScope scope;
   uint64_t num_loops = isize * jsize * ksize;
   sstmac::sw::OperatingSystem::currentThread()->parentApp()
     ->computeLoop(num_loops, nflops_per_loop, nintops_per_loop, bytes_per_loop);
@@ -150,6 +178,7 @@ sstmac_compute_loop4(uint64_t isize, uint64_t jsize, uint64_t ksize, uint64_t ls
                      uint32_t nflops_per_loop,
                      uint32_t nintops_per_loop,
                      uint32_t bytes_per_loop){
+  AppComputeScope scope;
   uint64_t num_loops = isize * jsize * ksize * lsize;
   sstmac::sw::OperatingSystem::currentThread()->parentApp()
     ->computeLoop(num_loops, nflops_per_loop, nintops_per_loop, bytes_per_loop);
@@ -53,6 +53,8 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sprockit/sim_parameters.h>
 #include <sstmac/software/process/operating_system.h>
 #include <sstmac/software/process/thread.h>
+#include <sstmac/hardware/node/node.h>
+#include <sstmac/hardware/processor/processor.h>
 
 RegisterDebugSlot(lib_compute_inst);
 
@@ -62,7 +64,12 @@ namespace sw {
 RegisterKeywords(
  { "lib_compute_unroll_loops", "DEPRECATED: tunes the loop control overhead for compute loop functions" },
  { "lib_compute_loop_overhead", "the number of instructions in control overhead per compute loop" },
- { "lib_compute_access_width", "the size of each memory access access in bits" }
+ { "lib_compute_access_width", "the size of each memory access access in bits" },
+ { "omp_fork_join", "whether OpenMP parallel regions pay fork, join and load imbalance costs" },
+ { "omp_fork_latency", "the fixed time to fork a team of OpenMP threads" },
+ { "omp_fork_per_thread", "the additional time to fork each OpenMP thread" },
+ { "omp_barrier_latency", "the time per level of the tree barrier joining OpenMP threads" },
+ { "omp_imbalance", "the extra work of the slowest OpenMP thread as a fraction of the average" }
 );
 
 LibComputeInst::LibComputeInst(SST::Params& params,
@@ -95,11 +102,53 @@ LibComputeInst::computeDetailed(
   st.mem_sequential = bytes;
   st.nthread = nthread;
 
+  //the region runs on this thread, the slowest thread of the team sets its length
+  bool fork_join = omp_fork_join_ && nthread > 1;
+  TimeDelta overhead;
+  if (fork_join){
+    overhead = forkJoinOverhead(nthread);
+  }
+
+  Thread* thr = os_->activeThread();
+  if (thr->lazyCompute()){
+    TimeDelta t;
+    //only compute without memory contention can skip the hardware model
+    if (nthread <= thr->numActiveCcores() && os_->node()->proc()->estimateCompute(cmsg, t)){
+      if (fork_join){
+        overhead += t * omp_imbalance_;
+      }
+      thr->accumulateCompute(t + overhead);
+      delete cmsg;
+      return;
+    }
+    //the hardware model must see the correct start time
+    thr->flushCompute();
+  }
+
   // Do not overwrite an existing tag
   FTQScope scope(os_->activeThread(), FTQTag::compute);
 
+  Timestamp start = os_->now();
   computeInst(cmsg, nthread);
   delete cmsg;
+
+  if (fork_join){
+    //the imbalance only stretches the critical path, the memory system
+    //has already seen all the traffic of the region
+    overhead += (os_->now() - start) * omp_imbalance_;
+    compute(overhead);
+  }
+}
+
+TimeDelta
+LibComputeInst::forkJoinOverhead(int nthread) const
+{
+  int barrier_levels = 0;
+  while ((1 << barrier_levels) < nthread){
+    ++barrier_levels;
+  }
+  return omp_fork_latency_ + omp_fork_per_thread_ * (nthread - 1)
+      + omp_barrier_latency_ * barrier_levels;
 }
 
 void
@@ -126,6 +175,15 @@ LibComputeInst::init(SST::Params& params)
   } else {
     loop_overhead_ = params.find<double>("lib_compute_loop_overhead", 1.0);
   }
+
+  omp_fork_join_ = params.find<bool>("omp_fork_join", false);
+  omp_fork_latency_ = TimeDelta(params.find<SST::UnitAlgebra>("omp_fork_latency", "1us").getValue().toDouble());
+  omp_fork_per_thread_ = TimeDelta(params.find<SST::UnitAlgebra>("omp_fork_per_thread", "20ns").getValue().toDouble());
+  omp_barrier_latency_ = TimeDelta(params.find<SST::UnitAlgebra>("omp_barrier_latency", "100ns").getValue().toDouble());
+  omp_imbalance_ = params.find<double>("omp_imbalance", 0.05);
+  if (omp_imbalance_ < 0){
+    spkt_abort_printf("omp_imbalance must be non-negative, got %f", omp_imbalance_);
+  }
 }
 
 void
@@ -49,6 +49,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/software/libraries/compute/compute_event_fwd.h>
 #include <sstmac/software/process/software_id.h>
 #include <sstmac/common/sstmac_config.h>
+#include <sstmac/common/timestamp.h>
 #include <stdint.h>
 #include <sstmac/common/stats/ftq_tag.h>
 
@@ -92,6 +93,21 @@ class LibComputeInst :
  private:
   void init(SST::Params& params);
 
+  /**
+   * Fork-join cost of a parallel region run on the calling thread
+   * @param nthread The number of threads in the region
+   * @return The time to fork the team and join it at the closing barrier
+   */
+  TimeDelta forkJoinOverhead(int nthread) const;
+
+  /** Whether multithreaded computes pay fork, join and imbalance costs */
+  bool omp_fork_join_;
+  TimeDelta omp_fork_latency_;
+  TimeDelta omp_fork_per_thread_;
+  TimeDelta omp_barrier_latency_;
+  /** Extra work of the slowest thread as a fraction of the average */
+  double omp_imbalance_;
+
 };
 
 }
@@ -54,6 +54,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/software/api/api.h>
 #include <sstmac/software/process/operating_system.h>
 #include <sstmac/software/process/backtrace.h>
+#include <sstmac/software/process/iteration_sampler.h>
 #include <sstmac/common/sstmac_env.h>
 #include <sstmac/dumpi_util/dumpi_meta.h>
 #include <sstmac/software/launch/job_launcher.h>
@@ -75,10 +76,13 @@ static sprockit::NeedDeletestatics<sstmac::sw::UserAppCxxFullMain> del_app_stati
 RegisterKeywords(
  { "host_compute_timer", "whether to use the time elapsed on the host machine in compute modeling" },
  { "min_op_cutoff", "the minimum number of operations in a compute before detailed modeling is perfromed" },
+ { "lazy_compute", "whether to accumulate compute time and only advance the thread at the next API call" },
+ { "lazy_compute_max", "the maximum compute time to accumulate in lazy compute mode before advancing the thread" },
  { "notify", "whether the app should send completion notifications to job root" },
  { "globals_size", "the size of the global variable segment to allocate" },
  { "OMP_NUM_THREADS", "environment variable for configuring openmp" },
  { "exe", "an optional exe .so file to load for this app" },
+ { "iteration_sampling", "whether loops marked for sampling may fast-forward iterations" },
 );
 
 MakeDebugSlot(app_compute);
@@ -231,6 +235,7 @@ App::App(SST::Params& params, SoftwareId sid,
   compute_lib_(nullptr),
   next_tls_key_(0),
   min_op_cutoff_(0),
+  iteration_sampling_(true),
   globals_storage_(nullptr),
   notify_(true),
   rc_(0)
@@ -241,8 +246,11 @@ App::App(SST::Params& params, SoftwareId sid,
   if (host_compute){
     host_timer_ = new HostTimer;
   }
+  lazy_compute_ = params.find<bool>("lazy_compute", false);
+  lazy_compute_max_ = TimeDelta(params.find<SST::UnitAlgebra>("lazy_compute_max", "1ms").getValue().toDouble());
 
   notify_ = params.find<bool>("notify", true);
+  iteration_sampling_ = params.find<bool>("iteration_sampling", true);
 
   SST::Params env_params = params.get_scoped_params("env");
   omp_contexts_.emplace_back();
@@ -359,6 +367,9 @@ App::~App()
   //sprockit::delete_vals(apis_);
   if (compute_lib_) delete compute_lib_;
   if (globals_storage_) delete[] globals_storage_;
+  for (auto& pair : samplers_){
+    delete pair.second;
+  }
 }
 
 std::ostream&
@@ -446,9 +457,35 @@ App::cleanup()
   }
   subthreads_.clear();
 
+  if (tid() == 0){
+    for (auto& pair : samplers_){
+      pair.second->report(coutStream(), pair.first.c_str());
+    }
+  }
+
   Thread::cleanup();
 }
 
+IterationSampler*
+App::iterationSampler(const char* loop_id, int detail, int skip, int resample, double tolerance)
+{
+  auto iter = samplers_.find(loop_id);
+  if (iter == samplers_.end()){
+    //with sampling off the loop is still tracked, but never skips
+    auto* sampler = new IterationSampler(detail, iteration_sampling_ ? skip : 0, resample, tolerance);
+    samplers_[loop_id] = sampler;
+    return sampler;
+  }
+  return iter->second;
+}
+
+IterationSampler*
+App::findIterationSampler(const char* loop_id) const
+{
+  auto iter = samplers_.find(loop_id);
+  return iter == samplers_.end() ? nullptr : iter->second;
+}
+
 void
 App::sleep(TimeDelta time)
 {
@@ -67,6 +67,7 @@ Questions? Contact sst-macro-help@sandia.gov
 namespace sstmac {
 namespace sw {
 
+class IterationSampler;
 
 /**
  * The app derived class adds to the thread base class by providing
@@ -238,6 +239,19 @@ class App : public Thread
   std::ostream& coutStream();
   std::ostream& cerrStream();
 
+  /**
+   * @brief iterationSampler
+   * @param loop_id A unique string for the sampled loop, e.g. file:line
+   * @return The sampler for the loop, created with the given schedule on first use
+   */
+  IterationSampler* iterationSampler(const char* loop_id, int detail, int skip,
+                                     int resample, double tolerance);
+
+  /**
+   * @return The sampler for the loop, null if the loop never ran
+   */
+  IterationSampler* findIterationSampler(const char* loop_id) const;
+
  protected:
   friend class Thread;
 
@@ -268,6 +282,8 @@ class App : public Thread
   //these can alias - so I can't use unique_ptr
   std::map<std::string, API*> apis_;
   std::map<std::string,std::string> env_;
+  std::map<std::string, IterationSampler*> samplers_;
+  bool iteration_sampling_;
 
   char env_string_[64];
 
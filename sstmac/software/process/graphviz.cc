@@ -232,7 +232,7 @@ CallGraphOutput::CallGraphOutput(SST::Params& params) :
 void
 CallGraphOutput::startOutputGroup(StatisticGroup *grp)
 {
-  std::string fname = grp->name + ".csv";
+  std::string fname = grp->fileRoot() + ".csv";
   csv_summary_.open(fname);
 
   csv_summary_ << "Component,Function,CallFunction,Time";
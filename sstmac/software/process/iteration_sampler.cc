@@ -0,0 +1,201 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+
+#include <sstmac/software/process/iteration_sampler.h>
+#include <sprockit/errors.h>
+#include <sprockit/util.h>
+#include <cmath>
+#include <limits>
+#include <ostream>
+
+namespace sstmac {
+namespace sw {
+
+IterationSampler::IterationSampler(int detail, int skip, int resample, double tolerance) :
+  detail_(detail),
+  skip_(skip),
+  resample_(resample),
+  tolerance_(tolerance),
+  window_target_(detail),
+  timing_(false),
+  skip_left_(0),
+  mean_(0),
+  std_error_(0),
+  have_mean_(false),
+  num_detailed_(0),
+  num_skipped_(0),
+  num_windows_(0),
+  num_unsteady_(0),
+  detailed_time_(0),
+  skipped_time_(0),
+  skipped_error_(0),
+  max_drift_(0)
+{
+  if (detail_ < 2){
+    spkt_abort_printf("iteration sampling needs at least 2 detailed iterations, got %d", detail_);
+  }
+  if (skip_ < 0 || resample_ < 0){
+    spkt_abort_printf("iteration sampling got negative skip=%d or resample=%d", skip_, resample_);
+  }
+  if (resample_ == 1){
+    spkt_abort_printf("iteration sampling needs at least 2 iterations to resample");
+  }
+  window_.reserve(detail_);
+}
+
+void
+IterationSampler::closeWindow()
+{
+  if (window_.empty()) return;
+
+  double sum = 0;
+  for (double t : window_) sum += t;
+  double mean = sum / window_.size();
+  double var = 0;
+  for (double t : window_) var += (t - mean) * (t - mean);
+  int n = window_.size();
+  double stddev = n > 1 ? std::sqrt(var / (n - 1)) : 0.;
+
+  if (mean > 0 && stddev / mean > tolerance_){
+    ++num_unsteady_;
+  }
+  if (have_mean_ && mean_ > 0){
+    max_drift_ = std::max(max_drift_, std::fabs(mean - mean_) / mean_);
+  }
+  mean_ = mean;
+  std_error_ = stddev / std::sqrt(double(n));
+  have_mean_ = true;
+  ++num_windows_;
+  window_.clear();
+}
+
+void
+IterationSampler::recordIteration(Timestamp now)
+{
+  if (timing_){
+    double t = (now - iter_start_).sec();
+    window_.push_back(t);
+    detailed_time_ += t;
+    timing_ = false;
+  }
+}
+
+bool
+IterationSampler::beginIteration(Timestamp now, TimeDelta& charge)
+{
+  if (skip_ == 0){
+    //sampling turned off, everything runs in detail
+    ++num_detailed_;
+    return true;
+  }
+
+  recordIteration(now);
+
+  if (skip_left_ == 0 && window_.size() >= window_target_){
+    closeWindow();
+    skip_left_ = resample_ ? skip_ : std::numeric_limits<int>::max();
+    window_target_ = resample_;
+  }
+
+  if (skip_left_ > 0){
+    --skip_left_;
+    ++num_skipped_;
+    skipped_time_ += mean_;
+    skipped_error_ += std_error_;
+    charge = TimeDelta(mean_);
+    return false;
+  }
+
+  ++num_detailed_;
+  timing_ = true;
+  iter_start_ = now;
+  return true;
+}
+
+void
+IterationSampler::resetSchedule()
+{
+  //a partial window still says something about drift
+  if (window_.size() > 1) closeWindow();
+  window_.clear();
+  window_target_ = detail_;
+  skip_left_ = 0;
+}
+
+void
+IterationSampler::beginLoop()
+{
+  //the time since an abandoned iteration started includes code after the loop
+  timing_ = false;
+  resetSchedule();
+}
+
+void
+IterationSampler::endLoop(Timestamp now)
+{
+  recordIteration(now);
+  resetSchedule();
+}
+
+void
+IterationSampler::report(std::ostream& os, const char* loop_id) const
+{
+  double total = detailed_time_ + skipped_time_;
+  double rel_error = total > 0 ? skipped_error_ / total : 0.;
+  os << sprockit::sprintf("Sampled loop %s: %llu detailed, %llu fast-forwarded iterations, "
+                          "%12.8fs total, estimated error %6.3f%%, max drift %6.3f%% between windows\n",
+                          loop_id, (unsigned long long) num_detailed_,
+                          (unsigned long long) num_skipped_, total,
+                          rel_error * 100, max_drift_ * 100);
+  if (num_unsteady_){
+    os << sprockit::sprintf("WARNING: %llu of %llu detailed windows of loop %s exceeded "
+                            "the steady-state tolerance %6.3f%%\n",
+                            (unsigned long long) num_unsteady_, (unsigned long long) num_windows_,
+                            loop_id, tolerance_ * 100);
+  }
+}
+
+}
+}
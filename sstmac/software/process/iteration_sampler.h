@@ -0,0 +1,138 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+
+#ifndef sstmac_sw_process_iteration_sampler_h
+#define sstmac_sw_process_iteration_sampler_h
+
+#include <sstmac/common/timestamp.h>
+#include <iosfwd>
+#include <vector>
+
+namespace sstmac {
+namespace sw {
+
+/**
+ * Fast-forwards a timestep loop that has reached a steady state.
+ * The first iterations run in detail and their times are measured. After that,
+ * blocks of iterations are skipped and each skipped iteration is charged the
+ * mean time of the last detailed window. Short detailed windows are re-run
+ * between skipped blocks to follow any drift.
+ *
+ * Which iterations are skipped depends only on the iteration count, never on
+ * measured times. Every rank therefore skips the same iterations, and the
+ * communication in the loop body stays matched.
+ */
+class IterationSampler {
+ public:
+  /**
+   * @param detail   The number of detailed iterations before the first fast-forward
+   * @param skip     The number of iterations in each fast-forwarded block,
+   *                 zero to run every iteration in detail
+   * @param resample The number of detailed iterations between fast-forwarded blocks,
+   *                 zero to never resample
+   * @param tolerance The largest relative std deviation of a window that counts as steady
+   */
+  IterationSampler(int detail, int skip, int resample, double tolerance);
+
+  /**
+   * Called at the top of every iteration
+   * @param now   The current time
+   * @param charge [OUT] The time to charge if the iteration is fast-forwarded
+   * @return Whether to run the iteration in detail
+   */
+  bool beginIteration(Timestamp now, TimeDelta& charge);
+
+  /**
+   * Called every time the loop is entered. A previous pass that left through
+   * a return or goto never reached endLoop, so any iteration it was still
+   * timing is dropped and the schedule starts over.
+   */
+  void beginLoop();
+
+  /**
+   * Called once the loop exits. Closes the open window and resets for the next
+   * time the loop is entered.
+   */
+  void endLoop(Timestamp now);
+
+  void report(std::ostream& os, const char* loop_id) const;
+
+ private:
+  void recordIteration(Timestamp now);
+
+  void closeWindow();
+
+  void resetSchedule();
+
+  int detail_;
+  int skip_;
+  int resample_;
+  double tolerance_;
+
+  std::vector<double> window_;
+  int window_target_;
+  bool timing_;
+  Timestamp iter_start_;
+  int skip_left_;
+
+  /** The mean and standard error of the last closed window */
+  double mean_;
+  double std_error_;
+  bool have_mean_;
+
+  uint64_t num_detailed_;
+  uint64_t num_skipped_;
+  uint64_t num_windows_;
+  uint64_t num_unsteady_;
+  double detailed_time_;
+  double skipped_time_;
+  double skipped_error_;
+  double max_drift_;
+};
+
+}
+}
+
+#endif
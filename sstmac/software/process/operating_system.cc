@@ -301,6 +301,7 @@ void
 OperatingSystem::sleep(TimeDelta t)
 {
   CallGraphAppend(sleep);
+  active_thread_->flushCompute();
   FTQScope scope(active_thread_, FTQTag::sleep);
 
   sw::UnblockEvent* ev = new sw::UnblockEvent(this, active_thread_);
@@ -315,6 +316,7 @@ OperatingSystem::sleep(TimeDelta t)
 void
 OperatingSystem::sleepUntil(Timestamp t)
 {
+  active_thread_->flushCompute();
   Timestamp now_ = now();
   if (t > now_){
     FTQScope scope(active_thread_, FTQTag::sleep);
@@ -526,6 +528,8 @@ OperatingSystem::unblock(Thread* thr)
 void
 OperatingSystem::joinThread(Thread* t)
 {
+  //pending compute overlaps the wait, it must not be added after it
+  active_thread_->flushCompute();
   if (t->getState() != Thread::DONE) {
     //key* k = key::construct();
     os_debug("joining thread %ld - thread not done so blocking on thread %p",
@@ -742,6 +746,8 @@ void
 OperatingSystem::startThread(Thread* t)
 {
   if (active_thread_){
+    //the child cannot start before the parent's pending compute has elapsed
+    active_thread_->flushCompute();
     //crap - can't do this on this thread - need to do on DES thread
     sendExecutionEventNow(newCallback(this, &OperatingSystem::startThread, t));
   } else {
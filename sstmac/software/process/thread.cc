@@ -66,12 +66,16 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <unusedvariablemacro.h>
 
 MakeDebugSlot(host_compute)
+MakeDebugSlot(lazy_compute)
 
 namespace sstmac {
 namespace sw {
 
 static thread_safe_u32 THREAD_ID_CNT(0);
 
+std::atomic<uint64_t> Thread::lazy_compute_calls_(0);
+std::atomic<uint64_t> Thread::lazy_compute_flushes_(0);
+
 //
 // Private method that gets called by the scheduler.
 //
@@ -139,6 +143,8 @@ Thread::runRoutine(void* threadptr)
         //never leave this try block and closing the guard
         sstmac::sw::OperatingSystem::CoreAllocateGuard guard(self->os(), self);
         self->run();
+        //don't lose compute time still pending at exit
+        self->flushCompute();
       }
       //this doesn't so much kill the thread as context switch it out
       //it is up to the above delete thread event to actually to do deletion/cleanup
@@ -178,6 +184,8 @@ Thread::Thread(SST::Params& params, SoftwareId sid, OperatingSystem* os) :
   ftag_(FTQTag::null),
   sid_(sid),
   host_timer_(nullptr),
+  lazy_compute_(false),
+  app_compute_(false),
   last_bt_collect_nfxn_(0),
   bt_nfxn_(0),
   timed_out_(false),
@@ -219,6 +227,37 @@ Thread::startAPICall()
                  "host compute for %12.8es", duration);
     parentApp()->compute(TimeDelta(duration));
   }
+  flushCompute();
+}
+
+bool
+Thread::accumulateCompute(TimeDelta t)
+{
+  if (!lazy_compute_){
+    return false;
+  }
+
+  ++lazy_compute_calls_;
+  pending_compute_ += t;
+  if (pending_compute_ >= lazy_compute_max_){
+    flushCompute();
+  }
+  return true;
+}
+
+void
+Thread::flushCompute()
+{
+  if (pending_compute_.ticks() == 0){
+    return;
+  }
+
+  TimeDelta t = pending_compute_;
+  pending_compute_ = TimeDelta();
+  ++lazy_compute_flushes_;
+  debug_printf(sprockit::dbg::lazy_compute,
+               "flushing lazy compute block of %12.8es", t.sec());
+  os_->compute(t);
 }
 
 void
@@ -295,6 +334,8 @@ Thread::spawn(Thread* thr)
     thr->host_timer_ = new HostTimer;
     thr->host_timer_->start();
   }
+  thr->lazy_compute_ = lazy_compute_;
+  thr->lazy_compute_max_ = lazy_compute_max_;
   os_->startThread(thr);
 }
 
@@ -452,6 +493,7 @@ stdMutex::stdMutex()
 
 void stdMutex::lock()
 {
+  OperatingSystem::currentThread()->flushCompute();
   mutex_t* mut = parent_app_->getMutex(id_);
   if (mut == nullptr){
     spkt_abort_printf("error: bad mutex id for std::mutex: %d", id_);
@@ -470,6 +512,7 @@ stdMutex::~stdMutex()
 
 void stdMutex::unlock()
 {
+  OperatingSystem::currentThread()->flushCompute();
   mutex_t* mut = parent_app_->getMutex(id_);
   if (mut == nullptr || !mut->locked){
     return;
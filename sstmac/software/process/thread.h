@@ -64,6 +64,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/software/api/api_fwd.h>
 #include <sstmac/software/threading/threading_interface_fwd.h>
 #include <queue>
+#include <atomic>
 #include <map>
 #include <utility>
 #include <list>
@@ -371,6 +372,48 @@ class Thread
 
   void endAPICall();
 
+  /**
+   * @return Whether compute can be deferred. Only compute issued directly
+   *         by the application is, compute the simulator issues on its
+   *         behalf inside an API call, e.g. the reduction in a collective,
+   *         goes on to send messages that depend on it.
+   */
+  bool lazyCompute() const {
+    return lazy_compute_ && app_compute_;
+  }
+
+  /**
+   * @brief setAppCompute Mark whether the compute being issued comes
+   *        directly from application code
+   */
+  void setAppCompute(bool flag){
+    app_compute_ = flag;
+  }
+
+  /**
+   * @brief accumulateCompute In lazy compute mode, add the compute time
+   *        to a pending block instead of blocking the thread immediately.
+   *        The pending block is flushed once it exceeds lazy_compute_max.
+   * @param t The compute time to add
+   * @return Whether the time was accumulated. False if lazy compute is off.
+   */
+  bool accumulateCompute(TimeDelta t);
+
+  /**
+   * @brief flushCompute Block the thread for any compute time accumulated
+   *        in lazy compute mode. Must be called before the thread interacts
+   *        with the rest of the simulation.
+   */
+  void flushCompute();
+
+  static uint64_t numLazyComputeCalls() {
+    return lazy_compute_calls_;
+  }
+
+  static uint64_t numLazyComputeFlushes() {
+    return lazy_compute_flushes_;
+  }
+
   void setTag(const FTQTag& t){
     ftag_ = t;
   }
@@ -435,7 +478,20 @@ class Thread
 
   HostTimer* host_timer_;
 
+  bool lazy_compute_;
+
+  TimeDelta lazy_compute_max_;
+
+  TimeDelta pending_compute_;
+
+  /** Whether the compute being issued comes directly from the application */
+  bool app_compute_;
+
  private:
+  static std::atomic<uint64_t> lazy_compute_calls_;
+
+  static std::atomic<uint64_t> lazy_compute_flushes_;
+
   API* getAppApi(const std::string& name) const;
 
   CallGraphTrace backtrace_; //each function is labeled by unique integer
@@ -43,6 +43,7 @@ Questions? Contact sst-macro-help@sandia.gov
 */
 
 #include <sstmac/software/process/operating_system.h>
+#include <sstmac/software/process/thread.h>
 #include <sstmac/software/process/time.h>
 #include <time.h>
 #include <sys/time.h>
@@ -53,6 +54,8 @@ using sstmac::Timestamp;
 
 extern "C" int SSTMAC_gettimeofday(struct timeval* tv, struct timezone*  /*tz*/)
 {
+  //the clock must include any lazily accumulated compute
+  OperatingSystem::currentThread()->flushCompute();
   OperatingSystem* os = OperatingSystem::currentOs();
   uint64_t usecs = os->now().usecRounded();
   tv->tv_sec =  usecs / 1000000;
@@ -62,6 +65,7 @@ extern "C" int SSTMAC_gettimeofday(struct timeval* tv, struct timezone*  /*tz*/)
 
 extern "C" int SSTMAC_clock_gettime(clockid_t  /*id*/, struct timespec *ts)
 {
+  OperatingSystem::currentThread()->flushCompute();
   OperatingSystem* os = OperatingSystem::currentOs();
   uint64_t nsecs = os->now().nsecRounded();
   ts->tv_sec =  nsecs / 1000000000;
@@ -80,6 +84,7 @@ extern "C" int sstmac_ts_nanosleep(const struct timespec *req, struct timespec *
 
 extern "C" double sstmac_virtual_time()
 {
+  OperatingSystem::currentThread()->flushCompute();
   OperatingSystem* os = OperatingSystem::currentOs();
   return os->now().sec();
 }
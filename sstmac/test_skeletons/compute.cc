@@ -45,14 +45,54 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/replacements/mpi/mpi.h>
 #include <sstmac/compute.h>
 #include <sprockit/keyword_registration.h>
+#include <sprockit/errors.h>
 #include <sstmac/software/process/backtrace.h>
+#include <pthread.h>
+#include <sys/time.h>
 
 RegisterKeywords(
  { "nloop" , "the number of loops to perform" },
+ { "omp_threads", "if greater than 1, also time an OpenMP region with this many threads" },
+ { "nblocks", "the number of compute blocks without memory traffic to time" },
+ { "block_sync", "if greater than 0, allreduce after this many compute blocks" },
+ { "block_clock", "if greater than 0, also time the compute blocks with gettimeofday" },
+ { "pthread_blocks", "if greater than 0, overlap this many compute blocks with a pthread computing as many" },
 );
 
 #define sstmac_app_name test_compute_api
 
+static void
+computeBlock(int nloop, int me)
+{
+  //no memory traffic, lazy compute can merge these
+  sstmac_compute_detailed(nloop*100*(me+1), nloop*50, 0);
+  sstmac_compute(1e-6);
+}
+
+struct ComputeBlocksArgs {
+  int nloop;
+  int me;
+  int nblocks;
+};
+
+static void*
+computeBlocks(void* args)
+{
+  ComputeBlocksArgs* blocks = (ComputeBlocksArgs*) args;
+  for (int b=0; b < blocks->nblocks; ++b){
+    computeBlock(blocks->nloop, blocks->me);
+  }
+  return nullptr;
+}
+
+static double
+clockTime()
+{
+  timeval tv;
+  gettimeofday(&tv, nullptr);
+  return tv.tv_sec + 1e-6*tv.tv_usec;
+}
+
 int USER_MAIN(int argc, char** argv)
 {
   CallGraphAppend(main);
@@ -75,6 +115,51 @@ int USER_MAIN(int argc, char** argv)
   double t_total = t_stop - t_start;
   ::printf("Rank %d = %8.4fms\n", me, t_total*1e3);
 
+  int omp_threads = sstmac::getParam<int>("omp_threads", 1);
+  if (omp_threads > 1){
+    t_start = MPI_Wtime();
+    sstmac_compute_detailed_nthr(nloop*1000, nloop*1000, nloop*4000, omp_threads);
+    t_stop = MPI_Wtime();
+    ::printf("Rank %d OpenMP region = %8.4fus\n", me, (t_stop - t_start)*1e6);
+  }
+
+  int nblocks = sstmac::getParam<int>("nblocks", 0);
+  if (nblocks > 0){
+    int block_sync = sstmac::getParam<int>("block_sync", 0);
+    int block_clock = sstmac::getParam<int>("block_clock", 0);
+    t_start = MPI_Wtime();
+    double clock_start = block_clock > 0 ? clockTime() : 0;
+    for (int b=0; b < nblocks; ++b){
+      computeBlock(nloop, me);
+      if (block_sync > 0 && (b+1) % block_sync == 0){
+        int sum = 0;
+        MPI_Allreduce(&b, &sum, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+        if (sum != b*nproc){
+          spkt_abort_printf("rank %d got allreduce sum %d, expected %d", me, sum, b*nproc);
+        }
+      }
+    }
+    if (block_clock > 0){
+      ::printf("Rank %d gettimeofday blocks = %4.0fus\n", me, (clockTime() - clock_start)*1e6);
+    }
+    t_stop = MPI_Wtime();
+    ::printf("Rank %d blocks = %8.4fus\n", me, (t_stop - t_start)*1e6);
+  }
+
+  int pthread_blocks = sstmac::getParam<int>("pthread_blocks", 0);
+  if (pthread_blocks > 0){
+    t_start = MPI_Wtime();
+    //still pending when the pthread is created
+    computeBlock(nloop, me);
+    ComputeBlocksArgs args{nloop, me, pthread_blocks};
+    pthread_t thr;
+    pthread_create(&thr, nullptr, computeBlocks, &args);
+    computeBlocks(&args);
+    pthread_join(thr, nullptr);
+    t_stop = MPI_Wtime();
+    ::printf("Rank %d pthread blocks = %8.4fus\n", me, (t_stop - t_start)*1e6);
+  }
+
   MPI_Finalize();
   return 0;
 }
@@ -47,16 +47,24 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/skeleton.h>
 #include <sstmac/compute.h>
 #include <sstmac/util.h>
+#include <sprockit/keyword_registration.h>
+
+RegisterKeywords(
+ { "repeats", "the number of times to read each size" },
+);
 
 int USER_MAIN(int  /*argc*/, char**  /*argv*/)
 {
   std::vector<int> sizes = {4096, 16000, 64000, 1000000};
+  int nrepeats = sstmac::getParam<int>("repeats", 1);
   for (auto sz : sizes){
-    double start = sstmac_now();
-    sstmac_memread(sz);
-    double stop = sstmac_now();
-    double bw = sz/(stop-start);
-    printf("T=%10.7f   SIZE=%10d BW=%12.8fGB/s\n", stop, sz, bw/1e9);
+    for (int r=0; r < nrepeats; ++r){
+      double start = sstmac_now();
+      sstmac_memread(sz);
+      double stop = sstmac_now();
+      double bw = sz/(stop-start);
+      printf("T=%10.7f   SIZE=%10d BW=%12.8fGB/s\n", stop, sz, bw/1e9);
+    }
   }
   return 0;
 }
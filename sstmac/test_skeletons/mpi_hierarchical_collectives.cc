@@ -0,0 +1,113 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#include <sprockit/test/test.h>
+#include <sprockit/errors.h>
+#include <sstmac/util.h>
+#include <sstmac/replacements/mpi/mpi.h>
+#include <sstmac/skeleton.h>
+#include <mpi.h>
+#include <vector>
+
+#define sstmac_app_name mpi_hierarchical_collectives
+
+static const int count = 256;
+
+int USER_MAIN(int argc, char** argv)
+{
+  MPI_Init(&argc, &argv);
+
+  int me, nproc;
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+  MPI_Comm_size(MPI_COMM_WORLD, &nproc);
+
+  std::vector<int> send(count), recv(count);
+  for (int i=0; i < count; ++i){
+    send[i] = me + i;
+  }
+  //the sum over ranks of (rank + i)
+  auto expected = [=](int i){ return nproc*(nproc-1)/2 + nproc*i; };
+
+  MPI_Allreduce(send.data(), recv.data(), count, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  for (int i=0; i < count; ++i){
+    if (recv[i] != expected(i)){
+      spkt_abort_printf("rank %d: allreduce got %d at %d, expected %d",
+                        me, recv[i], i, expected(i));
+    }
+  }
+
+  //roots that lead nothing, lead a node, and sit at the very end
+  int roots[] = { 0, nproc / 2, nproc - 1 };
+  for (int root : roots){
+    std::fill(recv.begin(), recv.end(), -1);
+    MPI_Reduce(send.data(), recv.data(), count, MPI_INT, MPI_SUM, root, MPI_COMM_WORLD);
+    if (me == root){
+      for (int i=0; i < count; ++i){
+        if (recv[i] != expected(i)){
+          spkt_abort_printf("rank %d: reduce to %d got %d at %d, expected %d",
+                            me, root, recv[i], i, expected(i));
+        }
+      }
+    }
+
+    for (int i=0; i < count; ++i){
+      recv[i] = me == root ? root * i : -1;
+    }
+    MPI_Bcast(recv.data(), count, MPI_INT, root, MPI_COMM_WORLD);
+    for (int i=0; i < count; ++i){
+      if (recv[i] != root * i){
+        spkt_abort_printf("rank %d: bcast from %d got %d at %d, expected %d",
+                          me, root, recv[i], i, root * i);
+      }
+    }
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  if (me == 0){
+    printf("Hierarchical collectives passed on %d ranks\n", nproc);
+  }
+
+  MPI_Finalize();
+  return 0;
+}
@@ -129,7 +129,17 @@ MpiApi::waitall(int count, MPI_Request array_of_requests[],
   mpi_api_debug(sprockit::dbg::mpi | sprockit::dbg::mpi_request, 
     "MPI_Waitall(%d,...)", count);
   bool ignore_status = array_of_statuses == MPI_STATUSES_IGNORE;
-  std::vector<MPI_Request> req_vec;
+  std::vector<MpiRequest*> reqPtrs;
+  reqPtrs.reserve(count);
+  for (int i=0; i < count; ++i){
+    MPI_Request req = array_of_requests[i];
+    if (req != MPI_REQUEST_NULL){
+      reqPtrs.push_back(getRequest(req));
+    }
+  }
+  //progress all requests together rather than one wait per request
+  queue_->waitAll(reqPtrs);
+
   for (int i=0; i < count; ++i){
     MPI_Status* status = ignore_status ? MPI_STATUS_IGNORE : &array_of_statuses[i];
     int tag, source;
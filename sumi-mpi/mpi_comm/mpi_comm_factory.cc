@@ -63,6 +63,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <stdint.h>
 #include <iterator>
+#include <algorithm>
 
 namespace sstmac {
 namespace sw {
@@ -169,16 +170,72 @@ MpiCommFactory::commCreate(MpiComm* caller, MpiGroup* group)
 
 }
 
-typedef std::map<int, std::list<int> > key_to_ranks_map;
+using split_table_map = std::map<int, std::shared_ptr<const MpiGroupTable>>;
+
+/**
+ * Sort the gathered (next comm id, color, key) triples of a split into
+ * one membership table per color, ordered by key and then by parent rank.
+ * This is O(P log P) for the whole split rather than O(P) for each rank.
+ * @param caller  The communicator being split
+ * @param result  The gathered triples of all ranks in caller
+ * @param tables  The table for each non-negative color
+ * @return The largest comm id proposed by any rank
+ */
+static int
+buildSplitTables(MpiComm* caller, const int* result, split_table_map& tables)
+{
+  struct member {
+    int color;
+    int key;
+    int rank;
+  };
+
+  int nranks = caller->size();
+  int cid = -1;
+  std::vector<member> members;
+  members.reserve(nranks);
+  for (int rank=0; rank < nranks; ++rank){
+    const int* thisdata = result + 3*rank;
+    cid = std::max(cid, thisdata[0]);
+    if (thisdata[1] >= 0){
+      members.push_back({thisdata[1], thisdata[2], rank});
+    }
+  }
+
+  std::sort(members.begin(), members.end(),
+            [](const member& a, const member& b){
+    if (a.color != b.color) return a.color < b.color;
+    if (a.key != b.key) return a.key < b.key;
+    return a.rank < b.rank;
+  });
+
+  auto it = members.begin();
+  while (it != members.end()){
+    auto end = it;
+    while (end != members.end() && end->color == it->color) ++end;
+    std::vector<TaskId> task_list;
+    task_list.reserve(end - it);
+    for (auto m = it; m != end; ++m){
+      task_list.push_back(caller->peerTask(m->rank));
+    }
+    tables[it->color] = std::make_shared<const MpiGroupTable>(std::move(task_list));
+    it = end;
+  }
+  return cid;
+}
+
 #if !SSTMAC_DISTRIBUTED_MEMORY || SSTMAC_MMAP_COLLECTIVES
 
-typedef std::map<int, key_to_ranks_map> color_to_key_map;
 //comm id, comm root task id, tag
 
 struct comm_split_entry {
   int* buf;
   int refcount;
-  comm_split_entry() : buf(0), refcount(0) {}
+  int cid;
+  /** Built once by the first rank through the allgather, shared by all members */
+  split_table_map tables;
+  bool built;
+  comm_split_entry() : buf(0), refcount(0), cid(-1), built(false) {}
 };
 
 static std::map<int, //app ID
@@ -197,7 +254,6 @@ static std::map<int, //app ID
 MpiComm*
 MpiCommFactory::commSplit(MpiComm* caller, int my_color, int my_key)
 {
-  key_to_ranks_map key_map;
   int mydata[3];
   mydata[0] = next_id_;
   mydata[1] = my_color;
@@ -208,16 +264,25 @@ MpiCommFactory::commSplit(MpiComm* caller, int my_color, int my_key)
   //printf("Rank %d = {%d %d %d}\n",
   //       caller->rank(), next_id_, my_color, my_key);
 
+  int cid;
+  std::shared_ptr<const MpiGroupTable> table;
 #if SSTMAC_DISTRIBUTED_MEMORY && !SSTMAC_MMAP_COLLECTIVES
   int* result = new int[3*caller->size()];
   parent_->allgather(&mydata, 3, MPI_INT,
                      result, 3, MPI_INT,
                      caller->id());
+  split_table_map tables;
+  cid = buildSplitTables(caller, result, tables);
+  if (my_color >= 0){
+    table = tables[my_color];
+  }
+  delete[] result;
 #else
   sstmac::sw::apiLock();
   int root = caller->peerTask(int(0));
   int tag = caller->nextCollectiveTag();
-  comm_split_entry& entry = comm_split_entries[aid][int(caller->id())][root][tag];
+  auto& tag_map = comm_split_entries[aid][int(caller->id())][root];
+  comm_split_entry& entry = tag_map[tag];
   entry.refcount++;
   if (entry.buf == 0){
 #if SSTMAC_MMAP_COLLECTIVES
@@ -257,60 +322,17 @@ MpiCommFactory::commSplit(MpiComm* caller, int my_color, int my_key)
   auto op = parent_->startAllgather("MPI_Comm_split_allgather", caller->id(),
                                       3, MPI_INT, 3, MPI_INT, nullptr, nullptr);
   parent_->waitCollective(std::move(op));
-#endif
-
-  MpiComm* ret;
-  if (my_color < 0){ //I'm not part of this!
-    ret = MpiComm::comm_null;
-  } else {
-    int cid = -1;
-    int ninput_ranks = caller->size();
-    int new_comm_size = 0;
-    for (unsigned rank = 0; rank < ninput_ranks; rank++) {
-      int* thisdata = result + 3*rank;
-
-      int comm_id = thisdata[0];
-      int color = thisdata[1];
-      int key = thisdata[2];
-
-      if (color >= 0 && color == my_color){
-        key_map[key].push_back(rank);
-        ++new_comm_size;
-      }
-
-      if (comm_id > cid) {
-        cid = comm_id;
-      }
-    }
-
 
-    //the next id I use needs to be greater than this
-    next_id_ = cid + 1;
-
-    std::vector<TaskId> task_list(new_comm_size);
-
-    key_to_ranks_map::iterator it, end = key_map.end();
-    //iterate map in sorted order
-    int next_rank = 0;
-    int my_new_rank = -1;
-    for (it=key_map.begin(); it != end; ++it){
-      std::list<int>& ranks = it->second;
-      ranks.sort();
-      std::list<int>::iterator rit, rend = ranks.end();
-      for (rit=ranks.begin(); rit != rend; ++rit, ++next_rank){
-        int comm_rank = *rit;
-        TaskId tid = caller->peerTask(int(comm_rank));
-        task_list[next_rank] = tid;
-        if (comm_rank == caller->rank()){
-          my_new_rank = next_rank;
-        }
-      }
-    }
-    MpiGroup* grp = new MpiGroup(std::move(task_list));
-    ret = new MpiComm(cid, my_new_rank, grp, aid_, true/*delete this group*/);
+  sstmac::sw::apiLock();
+  if (!entry.built){
+    //every rank has filled in the buffer, build all the groups once
+    entry.cid = buildSplitTables(caller, result, entry.tables);
+    entry.built = true;
+  }
+  cid = entry.cid;
+  if (my_color >= 0){
+    table = entry.tables[my_color];
   }
-
-#if !SSTMAC_DISTRIBUTED_MEMORY || SSTMAC_MMAP_COLLECTIVES
   entry.refcount--;
   if (entry.refcount == 0){
 #if SSTMAC_MMAP_COLLECTIVES
@@ -319,10 +341,20 @@ MpiCommFactory::commSplit(MpiComm* caller, int my_color, int my_key)
 #else
     delete[] result;
 #endif
+    tag_map.erase(tag);
   }
+  sstmac::sw::apiUnlock();
 #endif
 
-  return ret;
+  if (my_color < 0){ //I'm not part of this!
+    return MpiComm::comm_null;
+  } else {
+    //the next id I use needs to be greater than this
+    next_id_ = cid + 1;
+    int my_new_rank = table->rankOfTask(caller->myTask());
+    MpiGroup* grp = new MpiGroup(std::move(table));
+    return new MpiComm(cid, my_new_rank, grp, aid_, true/*delete this group*/);
+  }
 }
 
 MpiComm*
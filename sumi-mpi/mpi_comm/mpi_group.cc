@@ -46,35 +46,69 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sumi-mpi/mpi_types.h>
 #include <sprockit/errors.h>
 #include <sprockit/stl_string.h>
+#include <algorithm>
 
 namespace sumi {
 
+MpiGroupTable::MpiGroupTable(std::vector<TaskId>&& tl) :
+  local_to_world_(std::move(tl))
+{
+  world_to_local_.reserve(local_to_world_.size());
+  for (int i=0; i < local_to_world_.size(); ++i){
+    world_to_local_.emplace_back(local_to_world_[i], i);
+  }
+  std::sort(world_to_local_.begin(), world_to_local_.end());
+}
+
+int
+MpiGroupTable::rankOfTask(TaskId t) const
+{
+  auto iter = std::lower_bound(world_to_local_.begin(), world_to_local_.end(),
+                               std::make_pair(t, 0));
+  if (iter != world_to_local_.end() && iter->first == t){
+    return iter->second;
+  }
+  return MPI_UNDEFINED;
+}
+
 MpiGroup::MpiGroup(const std::vector<TaskId>& tl) :
-  local_to_world_map_(tl),
-  size_(tl.size()),
-  is_comm_world_(false)
+  table_(std::make_shared<MpiGroupTable>(std::vector<TaskId>(tl))),
+  size_(tl.size())
+{
+}
+
+MpiGroup::MpiGroup(std::shared_ptr<const MpiGroupTable> table) :
+  table_(std::move(table)),
+  size_(table_->size())
 {
 }
 
 MpiGroup::MpiGroup(size_t size) :
- size_(size),
- is_comm_world_(true)
+ size_(size)
 {
 } // the comm_world constructor to save space
 
+const std::vector<TaskId>&
+MpiGroup::worldRanks() const
+{
+  static const std::vector<TaskId> identity;
+  return table_ ? table_->worldRanks() : identity;
+}
+
 TaskId
 MpiGroup::at(int rank)
 {
-  if (is_comm_world_){
+  if (!table_){
     return TaskId(rank);
   } else {
-    if (rank >= local_to_world_map_.size()){
+    if (rank >= table_->size()){
+      const std::vector<TaskId>& ranks = table_->worldRanks();
       spkt_throw_printf(sprockit::ValueError,
                         "invalid rank %d requested for MPI group %p of size %d with ranks %s",
-                        rank, this, local_to_world_map_.size(),
-                        local_to_world_map_.size() < 6 ? stlString(local_to_world_map_).c_str() : "");
+                        rank, this, ranks.size(),
+                        ranks.size() < 6 ? stlString(ranks).c_str() : "");
     }
-    return local_to_world_map_[rank];
+    return table_->at(rank);
   }
 }
 
@@ -85,7 +119,7 @@ MpiGroup::translateRanks(int n_ranks, const int* my_ranks, int* other_ranks, Mpi
     if (input_rank == MPI_PROC_NULL){
       other_ranks[i] = MPI_PROC_NULL;
     } else {
-      int global_rank_i = is_comm_world_ ? input_rank : local_to_world_map_[input_rank];
+      int global_rank_i = table_ ? table_->at(input_rank) : input_rank;
       other_ranks[i] = other_grp->rankOfTask(global_rank_i);
     }
   }
@@ -94,16 +128,11 @@ MpiGroup::translateRanks(int n_ranks, const int* my_ranks, int* other_ranks, Mpi
 int
 MpiGroup::rankOfTask(TaskId t) const
 {
-  if (is_comm_world_){
+  if (!table_){
     return int(t);
   } else {
-    for (int i=0; i < local_to_world_map_.size(); ++i){
-      if (local_to_world_map_[i] == t){
-        return int(i);
-      }
-    }
+    return table_->rankOfTask(t);
   }
-  return MPI_UNDEFINED;
 }
 
 }
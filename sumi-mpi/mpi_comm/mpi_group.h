@@ -48,17 +48,53 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sstmac/software/process/task_id.h>
 #include <sumi-mpi/mpi_integers.h>
 #include <vector>
+#include <memory>
 #include <cstring>
 
 namespace sumi {
 
 using sstmac::sw::TaskId;
 
+/**
+ * The membership of a group. A table is immutable once built, so all
+ * co-located ranks holding the same group (e.g. after MPI_Comm_split)
+ * share one copy instead of each keeping its own task list.
+ */
+class MpiGroupTable {
+ public:
+  MpiGroupTable(std::vector<TaskId>&& tl);
+
+  const std::vector<TaskId>& worldRanks() const {
+    return local_to_world_;
+  }
+
+  size_t size() const {
+    return local_to_world_.size();
+  }
+
+  TaskId at(int rank) const {
+    return local_to_world_[rank];
+  }
+
+  /**
+   * @return The group rank of the task or MPI_UNDEFINED, found by binary search
+   */
+  int rankOfTask(TaskId t) const;
+
+ private:
+  std::vector<TaskId> local_to_world_;
+  /** (world task, group rank) sorted by world task */
+  std::vector<std::pair<TaskId,int>> world_to_local_;
+
+};
+
 class MpiGroup  {
 
  public:
   MpiGroup(const std::vector<TaskId>& tl);
 
+  MpiGroup(std::shared_ptr<const MpiGroupTable> table);
+
   MpiGroup(size_t size);
 
   virtual ~MpiGroup() {}
@@ -78,11 +114,17 @@ class MpiGroup  {
   }
 
   bool isCommWorld() const {
-    return is_comm_world_;
+    return !table_;
   }
 
-  const std::vector<TaskId>& worldRanks() const {
-    return local_to_world_map_;
+  /**
+   * @return The world rank of each group rank, empty for comm world
+   *         whose mapping is the identity
+   */
+  const std::vector<TaskId>& worldRanks() const;
+
+  const std::shared_ptr<const MpiGroupTable>& table() const {
+    return table_;
   }
 
   /**
@@ -97,11 +139,11 @@ class MpiGroup  {
   void translateRanks(int n_ranks, const int* my_ranks, int* other_ranks, MpiGroup* other_grp);
 
  protected:
-  //map the local gorup rank to the world rank
-  std::vector<TaskId> local_to_world_map_;
+  //map the local group rank to the world rank, null for comm world
+  //we don't save all the peers for comm world to save space
+  std::shared_ptr<const MpiGroupTable> table_;
   MPI_Group id_;
-  size_t size_; //used for comm_world
-  bool is_comm_world_;  //we don't save all the peers to save space
+  size_t size_;
 
 };
 
@@ -468,34 +468,66 @@ MpiQueue::progressLoop(MpiRequest* req)
   return api_->now();
 }
 
-bool
-MpiQueue::atLeastOneComplete(const std::vector<MpiRequest*>& req)
+void
+MpiQueue::progressUntil(MpiRequestWaiter& waiter, const std::vector<MpiRequest*>& reqs)
 {
-  mpi_queue_debug("checking if any of %d requests is done", (int)req.size());
-  for (int i=0; i < (int) req.size(); ++i) {
-    if (req[i] && req[i]->isComplete()) {
-      mpi_queue_debug("request is done");
-      return true;
+  while (waiter.remaining > 0) {
+    mpi_queue_debug("blocking on progress loop with %d requests remaining",
+                    waiter.remaining);
+    sumi::Message* msg = queue_.find_any();
+    if (!msg){
+      spkt_abort_printf("polling returned null message");
+    }
+    incomingMessage(msg);
+  }
+
+  //wait-any leaves incomplete requests behind that must not touch our stack
+  for (MpiRequest* req : reqs){
+    if (req && req->waiter() == &waiter){
+      req->setWaiter(nullptr);
     }
   }
-  return false;
 }
 
 void
 MpiQueue::startProgressLoop(const std::vector<MpiRequest*>& reqs)
 {
-  mpi_queue_debug("starting progress loop");
-  while (!atLeastOneComplete(reqs)) {
-    mpi_queue_debug("blocking on progress loop");
-    sumi::Message* msg = queue_.find_any();
-    if (!msg){
-      spkt_abort_printf("polling returned null message");
+  mpi_queue_debug("starting progress loop on %d requests", (int)reqs.size());
+  for (MpiRequest* req : reqs){
+    if (req && req->isComplete()){
+      mpi_queue_debug("request is done");
+      return;
     }
-    incomingMessage(msg);
   }
+
+  MpiRequestWaiter waiter;
+  waiter.remaining = 1; //the first completion wakes us
+  for (MpiRequest* req : reqs){
+    if (req) req->setWaiter(&waiter);
+  }
+  progressUntil(waiter, reqs);
   mpi_queue_debug("finishing progress loop");
 }
 
+void
+MpiQueue::waitAll(const std::vector<MpiRequest*>& reqs)
+{
+  mpi_queue_debug("starting wait all on %d requests", (int)reqs.size());
+  MpiRequestWaiter waiter;
+  waiter.remaining = 0;
+  sstmac::Timestamp wait_start = api_->now();
+  for (MpiRequest* req : reqs){
+    //the same request can legally show up twice - only count it once
+    if (req && !req->isComplete() && req->waiter() != &waiter){
+      req->setWaiter(&waiter);
+      req->setWaitStart(wait_start);
+      ++waiter.remaining;
+    }
+  }
+  progressUntil(waiter, reqs);
+  mpi_queue_debug("finishing wait all");
+}
+
 void
 MpiQueue::forwardProgress(double timeout)
 {
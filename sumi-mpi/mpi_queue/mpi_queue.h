@@ -123,8 +123,18 @@ class MpiQueue
 
   void nonblockingProgress();
 
+  /**
+   * @brief startProgressLoop Block until at least one of the requests completes
+   * @param req  The requests, null entries are ignored
+   */
   void startProgressLoop(const std::vector<MpiRequest*>& req);
 
+  /**
+   * @brief waitAll Block until all of the requests complete
+   * @param req  The requests, null entries are ignored
+   */
+  void waitAll(const std::vector<MpiRequest*>& req);
+
   void startProgressLoop(const std::vector<MpiRequest*>& req,
                       sstmac::TimeDelta timeout);
 
@@ -179,7 +189,11 @@ class MpiQueue
 
   void clearPending();
 
-  bool atLeastOneComplete(const std::vector<MpiRequest*>& req);
+  /**
+   * @brief progressUntil Process incoming messages until the waiter counts down to zero
+   *        and detach the waiter from any request still pointing at it
+   */
+  void progressUntil(MpiRequestWaiter& waiter, const std::vector<MpiRequest*>& reqs);
 
  private:
   /// The sequence number for our next outbound transmission.
@@ -143,6 +143,16 @@ struct CollectivevOp :
                 int* recvcnts, int* rdisps, MpiComm* comm);
 };
 
+/**
+ * Countdown shared by all requests a blocking wait call is watching.
+ * A request decrements it exactly once when it completes so the wait
+ * never needs to rescan its request list.
+ */
+struct MpiRequestWaiter
+{
+  int remaining;
+};
+
 class MpiRequest :
   public sprockit::thread_safe_new<MpiRequest>
 {
@@ -159,7 +169,8 @@ class MpiRequest :
    cancelled_(false),
    optype_(ty),
    persistent_op_(nullptr),
-   collective_op_(nullptr)
+   collective_op_(nullptr),
+   waiter_(nullptr)
   {
   }
 
@@ -188,10 +199,26 @@ class MpiRequest :
 
   void complete() {
     complete_ = true;
+    if (waiter_){
+      --waiter_->remaining;
+      waiter_ = nullptr;
+    }
   }
 
   void setComplete(bool flag){
-    complete_ = flag;
+    if (flag){
+      complete();
+    } else {
+      complete_ = false;
+    }
+  }
+
+  MpiRequestWaiter* waiter() const {
+    return waiter_;
+  }
+
+  void setWaiter(MpiRequestWaiter* w){
+    waiter_ = w;
   }
 
   void setPersistent(PersistentOp* op) {
@@ -258,6 +285,8 @@ class MpiRequest :
 
   sstmac::Timestamp wait_start_;
 
+  MpiRequestWaiter* waiter_;
+
 };
 
 }
@@ -44,10 +44,29 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <sumi/communicator.h>
 #include <sumi/transport.h>
+#include <sumi/locality_hierarchy.h>
 #include <sprockit/errors.h>
+#include <algorithm>
 
 namespace sumi {
 
+Communicator::~Communicator()
+{
+  for (auto& pair : hierarchies_){
+    delete pair.second;
+  }
+}
+
+LocalityHierarchy*
+Communicator::localityHierarchy(Transport* tport, int level, int root)
+{
+  LocalityHierarchy*& hier = hierarchies_[std::make_pair(level, root)];
+  if (!hier){
+    hier = new LocalityHierarchy(tport, this, LocalityHierarchy::level_t(level), root);
+  }
+  return hier;
+}
+
 void
 Communicator::rankResolved(int global_rank, int comm_rank)
 {
@@ -163,9 +182,11 @@ MapCommunicator::MapCommunicator(int rank, std::vector<int>&& local_to_global)
  : Communicator(rank),
    local_to_global_(std::move(local_to_global))
 {
+  global_to_local_.reserve(local_to_global_.size());
   for (int idx=0; idx < local_to_global_.size(); ++idx){
-    global_to_local_[local_to_global_[idx]] = idx;
+    global_to_local_.emplace_back(local_to_global_[idx], idx);
   }
+  std::sort(global_to_local_.begin(), global_to_local_.end());
 }
 
 int
@@ -178,8 +199,9 @@ MapCommunicator::commToGlobalRank(int comm_rank) const
 int
 MapCommunicator::globalToCommRank(int global_rank) const
 {
-  auto iter = global_to_local_.find(global_rank);
-  if (iter == global_to_local_.end()){
+  auto iter = std::lower_bound(global_to_local_.begin(), global_to_local_.end(),
+                               std::make_pair(global_rank, 0));
+  if (iter == global_to_local_.end() || iter->first != global_rank){
     spkt_abort_printf("Bad global rank %d requested for comm of size %d",
                       global_rank, global_to_local_.size());
   }
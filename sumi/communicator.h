@@ -52,6 +52,8 @@ Questions? Contact sst-macro-help@sandia.gov
 
 namespace sumi {
 
+class LocalityHierarchy;
+
 class Communicator {
  public:
   class RankCallback {
@@ -65,7 +67,7 @@ class Communicator {
     return my_comm_rank_;
   }
 
-  virtual ~Communicator(){}
+  virtual ~Communicator();
 
   /**
    * @brief comm_to_global_rank
@@ -110,6 +112,17 @@ class Communicator {
     rank_callbacks_.erase(cback);
   }
 
+  /**
+   * @brief localityHierarchy
+   * Hierarchies are built lazily on first use and cached for the
+   * lifetime of the communicator.
+   * @param tport The transport providing the rank to node mapping
+   * @param level The coarsest locality level (see LocalityHierarchy::level_t)
+   * @param root The comm rank that should lead each of its domains
+   * @return The node/switch/group split of this communicator
+   */
+  LocalityHierarchy* localityHierarchy(Transport* tport, int level, int root);
+
  protected:
   Communicator(int comm_rank) :
     my_comm_rank_(comm_rank),
@@ -133,6 +146,8 @@ class Communicator {
   Communicator* owner_comm_;
   bool smp_balanced_;
 
+  std::map<std::pair<int,int>, LocalityHierarchy*> hierarchies_;
+
 };
 
 class GlobalCommunicator :
@@ -166,7 +181,7 @@ class MapCommunicator :
   MapCommunicator(int rank, std::vector<int>&& local_to_global);
 
   int nproc() const override {
-    return global_to_local_.size();
+    return local_to_global_.size();
   }
 
   int commToGlobalRank(int comm_rank) const override;
@@ -176,7 +191,8 @@ class MapCommunicator :
   std::set<int> globalRankSetIntersection(const std::set<int> &neighbors) const override;
 
  private:
-  std::map<int, int> global_to_local_;
+  /** (global rank, comm rank) sorted by global rank for binary search */
+  std::vector<std::pair<int,int>> global_to_local_;
   std::vector<int> local_to_global_;
 };
 
@@ -0,0 +1,162 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#include <sumi/locality_hierarchy.h>
+#include <sumi/communicator.h>
+#include <sumi/transport.h>
+#include <sstmac/hardware/topology/topology.h>
+#include <sprockit/errors.h>
+#include <algorithm>
+#include <map>
+
+namespace sumi {
+
+static int
+localityKey(Transport* tport, sstmac::hw::Topology* top,
+            Communicator* comm, int lvl, int comm_rank)
+{
+  int global_rank = comm->commToGlobalRank(comm_rank);
+  int nid = tport->nidlist()[global_rank];
+  if (lvl == LocalityHierarchy::node_level || !top){
+    return nid;
+  }
+  int sid = top->endpointToSwitch(nid);
+  if (lvl == LocalityHierarchy::switch_level){
+    return sid;
+  }
+  return top->switchGroup(sid);
+}
+
+static Communicator*
+makeDomain(Communicator* comm, const std::vector<int>& members, int me)
+{
+  int my_idx = -1;
+  std::vector<int> global_ranks(members.size());
+  for (int i=0; i < members.size(); ++i){
+    global_ranks[i] = comm->commToGlobalRank(members[i]);
+    if (members[i] == me) my_idx = i;
+  }
+  return new IndexCommunicator(my_idx, members.size(), std::move(global_ranks));
+}
+
+LocalityHierarchy::LocalityHierarchy(Transport* tport, Communicator* comm,
+                                     level_t level, int root) :
+  level_(level),
+  root_(root)
+{
+  top_.comm = nullptr;
+  top_.root = 0;
+
+  sstmac::hw::Topology* top = sstmac::hw::Topology::global();
+  int me = comm->myCommRank();
+  std::vector<int> participants(comm->nproc());
+  for (int i=0; i < participants.size(); ++i){
+    participants[i] = i;
+  }
+
+  bool leader = true;
+  for (int lvl=node_level; lvl <= level && leader; ++lvl){
+    std::map<int,std::vector<int>> domains;
+    for (int rank : participants){
+      domains[localityKey(tport, top, comm, lvl, rank)].push_back(rank);
+    }
+    //no locality at this level, nothing to gain
+    if (domains.size() == participants.size()) continue;
+
+    int my_key = localityKey(tport, top, comm, lvl, me);
+    std::vector<int> leaders;
+    leaders.reserve(domains.size());
+    for (auto& pair : domains){
+      std::vector<int>& members = pair.second;
+      auto root_iter = std::find(members.begin(), members.end(), root);
+      int domain_leader = root_iter == members.end() ? members.front() : root;
+      leaders.push_back(domain_leader);
+      if (pair.first == my_key && members.size() > 1){
+        Stage stage;
+        stage.comm = makeDomain(comm, members, me);
+        stage.root = std::distance(members.begin(),
+                        std::find(members.begin(), members.end(), domain_leader));
+        stage.level = level_t(lvl);
+        stages_.push_back(stage);
+        leader = domain_leader == me;
+      }
+    }
+    std::sort(leaders.begin(), leaders.end());
+    participants = std::move(leaders);
+  }
+
+  if (leader && participants.size() > 1){
+    auto root_iter = std::find(participants.begin(), participants.end(), root);
+    if (root_iter == participants.end()){
+      spkt_abort_printf("LocalityHierarchy: root %d is not a top-level leader", root);
+    }
+    top_.comm = makeDomain(comm, participants, me);
+    top_.root = std::distance(participants.begin(), root_iter);
+  }
+}
+
+LocalityHierarchy::~LocalityHierarchy()
+{
+  for (Stage& stage : stages_){
+    delete stage.comm;
+  }
+  if (top_.comm) delete top_.comm;
+}
+
+bool
+LocalityHierarchy::parseAlgorithm(const std::string& name, level_t& level)
+{
+  if (name == "hierarchical_node"){
+    level = node_level;
+  } else if (name == "hierarchical_switch"){
+    level = switch_level;
+  } else if (name == "hierarchical_group"){
+    level = group_level;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+}
@@ -0,0 +1,144 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#ifndef sumi_api_LOCALITY_HIERARCHY_H
+#define sumi_api_LOCALITY_HIERARCHY_H
+
+#include <sumi/communicator_fwd.h>
+#include <sumi/transport_fwd.h>
+#include <string>
+#include <vector>
+
+namespace sumi {
+
+/**
+ * @class LocalityHierarchy
+ * Splits a communicator into nested locality domains (ranks sharing a node,
+ * then node leaders sharing a switch, then switch leaders sharing a topology group)
+ * for hierarchical collectives. Locality is read from the task mapping and
+ * the global topology, so no communication is needed to build the hierarchy.
+ * Each rank only keeps the domains it participates in.
+ */
+class LocalityHierarchy {
+ public:
+  typedef enum {
+    node_level = 0,
+    switch_level = 1,
+    group_level = 2
+  } level_t;
+
+  static const int max_levels = group_level + 1;
+
+  struct Stage {
+    /** The domain at this level, indexed by global ranks */
+    Communicator* comm;
+    /** The rank within comm that leads the domain */
+    int root;
+    /** The locality level of the domain. Ranks skip levels where their
+     *  domain is trivial, so this, not the stage index, identifies the domain */
+    level_t level;
+  };
+
+  /**
+   * @param tport The transport providing the rank to node mapping
+   * @param comm The communicator to split
+   * @param level The coarsest level of locality to exploit
+   * @param root A comm rank that should lead every domain it belongs to
+   */
+  LocalityHierarchy(Transport* tport, Communicator* comm, level_t level, int root);
+
+  ~LocalityHierarchy();
+
+  /**
+   * @return The non-trivial domains this rank belongs to, from finest to coarsest.
+   *         This rank leads every stage except possibly the last one.
+   */
+  const std::vector<Stage>& stages() const {
+    return stages_;
+  }
+
+  /**
+   * @return The communicator of all top-level leaders, if this rank is one
+   *         and there is more than one. Null otherwise.
+   */
+  Communicator* top() const {
+    return top_.comm;
+  }
+
+  /**
+   * @return The rank in the top communicator that leads the root's domains
+   */
+  int topRoot() const {
+    return top_.root;
+  }
+
+  level_t level() const {
+    return level_;
+  }
+
+  int root() const {
+    return root_;
+  }
+
+  /**
+   * @brief parseAlgorithm
+   * Collective algorithm names of the form hierarchical_node, hierarchical_switch,
+   * and hierarchical_group select the hierarchical variants.
+   * @param name The algorithm name
+   * @param level [out] The locality level for the algorithm
+   * @return Whether the name denotes a hierarchical algorithm
+   */
+  static bool parseAlgorithm(const std::string& name, level_t& level);
+
+ private:
+  level_t level_;
+  int root_;
+  std::vector<Stage> stages_;
+  Stage top_;
+
+};
+
+}
+
+#endif // LOCALITY_HIERARCHY_H
@@ -93,7 +93,9 @@ WilkeReduceActor::initBuffers()
   send_buffer_ = result_buffer_;
 
   //we will now only work with the dst buffer
-  my_api_->memcopy(send_buffer_, src, size);
+  //hierarchical reductions chain stages in place
+  if (send_buffer_ != src)
+    my_api_->memcopy(send_buffer_, src, size);
 }
 
 void
@@ -58,6 +58,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <sumi/gatherv.h>
 #include <sumi/scatterv.h>
 #include <sumi/scan.h>
+#include <sumi/locality_hierarchy.h>
 #include <sprockit/stl_string.h>
 #include <sprockit/sim_parameters.h>
 #include <sprockit/keyword_registration.h>
@@ -70,6 +71,9 @@ RegisterKeywords(
 { "eager_cutoff", "what message size in bytes to switch from eager to rendezvous" },
 { "use_put_protocol", "whether to use a put or get protocol for pt2pt sends" },
 { "algorithm", "the specific algorithm to use for a given collecitve" },
+{ "allreduce", "the allreduce algorithm: wilke or hierarchical_node/switch/group" },
+{ "reduce", "the reduce algorithm: wilke or hierarchical_node/switch/group" },
+{ "bcast", "the bcast algorithm: btree or hierarchical_node/switch/group" },
 { "comm_sync_stats", "whether to track synchronization stats for communication" },
 { "smp_single_copy_size", "the minimum size of message for single-copy protocol" },
 { "max_eager_msg_size", "the maximum size for using eager pt2pt protocol" },
@@ -554,6 +558,9 @@ CollectiveEngine::CollectiveEngine(SST::Params& params, Transport *tport) :
   use_put_protocol_ = params.find<bool>("use_put_protocol", false);
   alltoall_type_ = params.find<std::string>("alltoall", "bruck");
   allgather_type_ = params.find<std::string>("allgather", "bruck");
+  allreduce_type_ = params.find<std::string>("allreduce", "wilke");
+  reduce_type_ = params.find<std::string>("reduce", "wilke");
+  bcast_type_ = params.find<std::string>("bcast", "btree");
 
   int default_qos = params.find<int>("default_qos", 0);
   rdma_get_qos_ = params.find<int>("collective_rdma_get_qos", default_qos);
@@ -625,6 +632,16 @@ CollectiveEngine::allreduce(void* dst, void *src, int nelems, int type_size, int
 
   if (!comm) comm = global_domain_;
 
+  LocalityHierarchy::level_t level;
+  if (LocalityHierarchy::parseAlgorithm(allreduce_type_, level)){
+    //negative system tags cannot carry the stage bits
+    if (tag >= 0){
+      return hierarchicalAllreduce(dst, src, nelems, type_size, tag, fxn, cq_id, comm, level);
+    }
+  } else if (allreduce_type_ != "wilke"){
+    spkt_abort_printf("invalid allreduce type requested: %s", allreduce_type_.c_str());
+  }
+
   Collective* coll = nullptr;
   if (comm->smpComm()){
     //tags are restricted to 28 bits - the front 4 bits are mine for various internal operations
@@ -695,6 +712,16 @@ CollectiveEngine::reduce(int root, void* dst, void *src, int nelems, int type_si
   if (msg) return msg;
 
   if (!comm) comm = global_domain_;
+
+  LocalityHierarchy::level_t level;
+  if (LocalityHierarchy::parseAlgorithm(reduce_type_, level)){
+    if (tag >= 0){
+      return hierarchicalReduce(root, dst, src, nelems, type_size, tag, fxn, cq_id, comm, level);
+    }
+  } else if (reduce_type_ != "wilke"){
+    spkt_abort_printf("invalid reduce type requested: %s", reduce_type_.c_str());
+  }
+
   DagCollective* coll = new WilkeHalvingReduce(this, root, dst, src, nelems, type_size, tag, fxn, cq_id, comm);
   return startCollective(coll);
 }
@@ -707,10 +734,157 @@ CollectiveEngine::bcast(int root, void *buf, int nelems, int type_size, int tag,
   if (msg) return msg;
 
   if (!comm) comm = global_domain_;
+
+  LocalityHierarchy::level_t level;
+  if (LocalityHierarchy::parseAlgorithm(bcast_type_, level)){
+    if (tag >= 0){
+      return hierarchicalBcast(root, buf, nelems, type_size, tag, cq_id, comm, level);
+    }
+  } else if (bcast_type_ != "btree"){
+    spkt_abort_printf("invalid bcast type requested: %s", bcast_type_.c_str());
+  }
+
   DagCollective* coll = new BinaryTreeBcastCollective(this, root, buf, nelems, type_size, tag, cq_id, comm);
   return startCollective(coll);
 }
 
+/**
+ * Completes a chain of hierarchical stages on the original communicator
+ * and releases the temporary result buffer of intermediate leaders.
+ */
+class ReleaseWorkspaceCollective : public DoNothingCollective
+{
+ public:
+  ReleaseWorkspaceCollective(CollectiveEngine* engine, int tag, int cq_id, Communicator* comm,
+                             void* workspace, uint64_t size) :
+    DoNothingCollective(engine, tag, cq_id, comm),
+    workspace_(workspace), size_(size)
+  {
+  }
+
+  ~ReleaseWorkspaceCollective() override {
+    if (workspace_) my_api_->freeWorkspace(workspace_, size_);
+  }
+
+ private:
+  void* workspace_;
+  uint64_t size_;
+};
+
+/**
+ * Collects the stages of a hierarchical collective into a subsequent chain.
+ * Tags are restricted to 28 bits - the front 4 bits distinguish the stages.
+ * Stage tags must come from the locality level, not the position in the chain,
+ * since ranks alone in their domain at some level have fewer stages.
+ */
+class CollectiveChain
+{
+ public:
+  CollectiveChain() : first_(nullptr), last_(nullptr) {}
+
+  void append(Collective* coll){
+    if (last_) last_->setSubsequent(coll);
+    else first_ = coll;
+    last_ = coll;
+  }
+
+  Collective* first() const {
+    return first_;
+  }
+
+  static int stageTag(int level, int tag){
+    return (level+1)<<28 | tag;
+  }
+
+  static int topTag(int tag){
+    return stageTag(LocalityHierarchy::max_levels, tag);
+  }
+
+ private:
+  Collective* first_;
+  Collective* last_;
+};
+
+CollectiveDoneMessage*
+CollectiveEngine::hierarchicalAllreduce(void* dst, void* src, int nelems, int type_size, int tag,
+                                        reduce_fxn fxn, int cq_id, Communicator* comm, int level)
+{
+  LocalityHierarchy* hier = comm->localityHierarchy(tport_, level, 0);
+  auto& stages = hier->stages();
+  CollectiveChain chain;
+  //reduce up the hierarchy until reaching a domain I do not lead
+  void* stage_src = src;
+  for (int i=0; i < stages.size(); ++i){
+    chain.append(new WilkeHalvingReduce(this, stages[i].root, dst, stage_src, nelems, type_size,
+                                        CollectiveChain::stageTag(stages[i].level, tag), fxn, cq_id, stages[i].comm));
+    stage_src = dst;
+  }
+  if (hier->top()){
+    chain.append(new WilkeHalvingAllreduce(this, dst, stage_src, nelems, type_size,
+                                           CollectiveChain::topTag(tag), fxn, cq_id, hier->top()));
+  }
+  //and broadcast back down through every domain I belong to
+  for (int i=int(stages.size()) - 1; i >= 0; --i){
+    chain.append(new BinaryTreeBcastCollective(this, stages[i].root, dst, nelems, type_size,
+                                               CollectiveChain::stageTag(stages[i].level, tag), cq_id, stages[i].comm));
+  }
+  //this should report back as done on the original communicator!
+  chain.append(new DoNothingCollective(this, tag, cq_id, comm));
+  return startCollective(chain.first());
+}
+
+CollectiveDoneMessage*
+CollectiveEngine::hierarchicalReduce(int root, void* dst, void* src, int nelems, int type_size, int tag,
+                                     reduce_fxn fxn, int cq_id, Communicator* comm, int level)
+{
+  LocalityHierarchy* hier = comm->localityHierarchy(tport_, level, root);
+  auto& stages = hier->stages();
+
+  //leaders other than the root are not given a valid result buffer
+  bool leader = hier->top();
+  for (auto& stage : stages){
+    if (stage.comm->myCommRank() == stage.root) leader = true;
+  }
+  uint64_t size = uint64_t(nelems) * type_size;
+  void* workspace = nullptr;
+  if (leader && comm->myCommRank() != root){
+    dst = workspace = tport_->allocateWorkspace(size, src);
+  }
+
+  CollectiveChain chain;
+  void* stage_src = src;
+  for (int i=0; i < stages.size(); ++i){
+    chain.append(new WilkeHalvingReduce(this, stages[i].root, dst, stage_src, nelems, type_size,
+                                        CollectiveChain::stageTag(stages[i].level, tag), fxn, cq_id, stages[i].comm));
+    stage_src = dst;
+  }
+  if (hier->top()){
+    chain.append(new WilkeHalvingReduce(this, hier->topRoot(), dst, stage_src, nelems, type_size,
+                                        CollectiveChain::topTag(tag), fxn, cq_id, hier->top()));
+  }
+  chain.append(new ReleaseWorkspaceCollective(this, tag, cq_id, comm, workspace, size));
+  return startCollective(chain.first());
+}
+
+CollectiveDoneMessage*
+CollectiveEngine::hierarchicalBcast(int root, void* buf, int nelems, int type_size, int tag,
+                                    int cq_id, Communicator* comm, int level)
+{
+  LocalityHierarchy* hier = comm->localityHierarchy(tport_, level, root);
+  auto& stages = hier->stages();
+  CollectiveChain chain;
+  if (hier->top()){
+    chain.append(new BinaryTreeBcastCollective(this, hier->topRoot(), buf, nelems, type_size,
+                                               CollectiveChain::topTag(tag), cq_id, hier->top()));
+  }
+  for (int i=int(stages.size()) - 1; i >= 0; --i){
+    chain.append(new BinaryTreeBcastCollective(this, stages[i].root, buf, nelems, type_size,
+                                               CollectiveChain::stageTag(stages[i].level, tag), cq_id, stages[i].comm));
+  }
+  chain.append(new DoNothingCollective(this, tag, cq_id, comm));
+  return startCollective(chain.first());
+}
+
 CollectiveDoneMessage*
 CollectiveEngine::gatherv(int root, void *dst, void *src,
                    int sendcnt, int *recv_counts,
@@ -532,6 +532,15 @@ class CollectiveEngine
 
   CollectiveDoneMessage* deliverPending(Collective* coll, int tag, Collective::type_t ty);
 
+  CollectiveDoneMessage* hierarchicalAllreduce(void* dst, void* src, int nelems, int type_size, int tag,
+                                               reduce_fxn fxn, int cq_id, Communicator* comm, int level);
+
+  CollectiveDoneMessage* hierarchicalReduce(int root, void* dst, void* src, int nelems, int type_size, int tag,
+                                            reduce_fxn fxn, int cq_id, Communicator* comm, int level);
+
+  CollectiveDoneMessage* hierarchicalBcast(int root, void* buf, int nelems, int type_size, int tag,
+                                           int cq_id, Communicator* comm, int level);
+
  private:
   Transport* tport_;
 
@@ -558,6 +567,9 @@ class CollectiveEngine
 
   std::string alltoall_type_;
   std::string allgather_type_;
+  std::string allreduce_type_;
+  std::string reduce_type_;
+  std::string bcast_type_;
 
   int rdma_header_qos_;
   int rdma_get_qos_;
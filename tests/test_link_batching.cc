@@ -0,0 +1,130 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+
+#include <sstmac/common/event_manager.h>
+#include <sstmac/common/event_handler.h>
+#include <sstmac/common/event_scheduler.h>
+#include <sstmac/backends/native/serial_runtime.h>
+#include <sprockit/sim_parameters.h>
+#include <cstdio>
+#include <string>
+
+using namespace sstmac;
+
+struct TagEvent : public Event {
+  NotSerializable(TagEvent)
+ public:
+  TagEvent(char t) : tag(t) {}
+  char tag;
+};
+
+/**
+ * Logs the tag of every event it receives and, on the batch head,
+ * sends a zero-delay event on another link
+ */
+class LogHandler : public EventHandler {
+ public:
+  LogHandler(std::string& log) : log_(log), link_(nullptr) {}
+
+  void sendOnHead(EventLink* link){
+    link_ = link;
+  }
+
+  void handle(Event* ev) override {
+    TagEvent* tev = static_cast<TagEvent*>(ev);
+    log_ += tev->tag;
+    if (tev->tag == 'A' && link_){
+      link_->send(TimeDelta(), new TagEvent('X'));
+    }
+    delete tev;
+  }
+
+  std::string toString() const override {
+    return "log handler";
+  }
+
+ private:
+  std::string& log_;
+  EventLink* link_;
+};
+
+/**
+ * Three events chained on one link, the head sends a same-time event on
+ * another link. The queue orders by (time, link id), so the new event
+ * must run before the rest of the chain only if its link id is lower.
+ */
+static void
+testBatch(EventManager* mgr, uint64_t other_link, const std::string& expected)
+{
+  std::string log;
+  //links own their handlers
+  LogHandler* batch_handler = new LogHandler(log);
+  LocalLink batch_link(10, TimeDelta(), mgr, batch_handler);
+  LocalLink other(other_link, TimeDelta(), mgr, new LogHandler(log));
+  batch_handler->sendOnHead(&other);
+
+  TimeDelta delay(1e-6);
+  TagEvent* head = new TagEvent('A');
+  batch_link.send(delay, head);
+  batch_link.send(delay, new TagEvent('B'));
+  batch_link.send(delay, new TagEvent('C'));
+  bool chained = head->batchNext() != nullptr;
+  mgr->runEvents(Timestamp(1.0));
+
+  printf("%s on batch with same-time event on link %d: %s\n",
+         chained && log == expected ? "SUCCESS" : "FAILURE",
+         int(other_link), log.c_str());
+}
+
+int main(int argc, char** argv)
+{
+  TimeDelta::initStamps(100);
+  SST::Params params;
+  native::SerialRuntime rt(params);
+  EventManager mgr(params, &rt);
+  testBatch(&mgr, 5, "AXBC");
+  testBatch(&mgr, 20, "ABCX");
+  return 0;
+}
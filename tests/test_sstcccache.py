@@ -0,0 +1,141 @@
+"""
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+"""
+
+# Drives the source-to-source cache with a stub tool in place of sstmac_clang.
+# The host compiler lists the includes of the forced header, so the test runs
+# without clang. usage: test_sstcccache.py <bin dir> <c++ compiler>
+
+import os
+import sys
+import shutil
+import tempfile
+
+sys.path.insert(0, sys.argv[1])
+compiler = shutil.which(sys.argv[2]) or sys.argv[2]
+
+from sstcccache import Src2SrcCache, CachedSrc2Src, DepScanner, precompileHeader
+
+stubTool = """#! %s
+import sys
+args = sys.argv[1:]
+open(%r, "a").write("run\\n")
+if "-include-pch" in args:
+  sys.exit(1) #a PCH from another clang
+src = open(args[0]).read()
+open(%r, "w").write("rewritten " + src)
+open(%r, "w").write("globals " + src)
+"""
+
+def write(path, text):
+  with open(path, "w") as f:
+    f.write(text)
+
+def check(name, ok):
+  print("%s on %s" % ("SUCCESS" if ok else "FAILURE", name))
+
+top = tempfile.mkdtemp()
+try:
+  cacheDir = os.path.join(top, "cache")
+  runLog = os.path.join(top, "runs")
+  srcRepl = os.path.join(top, "sst.pp.main.cc")
+  globalsFile = os.path.join(top, "sstGlobals.pp.main.cc.cpp")
+  tool = os.path.join(top, "sstmac_clang")
+  write(tool, stubTool % (sys.executable, runLog, srcRepl, globalsFile))
+  os.chmod(tool, 0o755)
+
+  source = os.path.join(top, "main.cc")
+  ppFile = os.path.join(top, "pp.main.cc")
+  forced = os.path.join(top, "forced.h")
+  nested = os.path.join(top, "nested.h")
+  write(source, "int main(){ return 0; }\n")
+  write(ppFile, "int main(){ return 0; }\n")
+  write(forced, '#include "nested.h"\n')
+  write(nested, "#define NESTED 1\n")
+
+  cache = Src2SrcCache(cacheDir)
+  cmdArr = [tool, ppFile, "--", "-include", forced]
+  outputs = [srcRepl, globalsFile]
+
+  def runs():
+    if not os.path.isfile(runLog):
+      return 0
+    return len(open(runLog).read().split())
+
+  def compile(pch=None):
+    for out in outputs:
+      if os.path.isfile(out):
+        os.remove(out)
+    step = CachedSrc2Src(cache, source, ppFile, cmdArr, outputs,
+                         DepScanner(compiler, [], "c++"), pch)
+    rc = step(False)
+    return rc == 0 and all(os.path.isfile(out) for out in outputs)
+
+  ok = compile()
+  check("first compile runs the tool", ok and runs() == 1)
+  ok = compile()
+  check("second compile hits the cache", ok and runs() == 1
+        and open(srcRepl).read() == "rewritten int main(){ return 0; }\n")
+
+  write(nested, "#define NESTED 2\n")
+  ok = compile()
+  check("edit of a nested forced include misses the cache", ok and runs() == 2)
+  ok = compile()
+  check("compile after the edit hits the cache", ok and runs() == 2)
+
+  write(ppFile, "int main(){ return 1; }\n")
+  ok = compile(pch=(forced, os.path.join(top, "forced.h.pch")))
+  check("rejected PCH falls back to the header", ok and runs() == 4
+        and open(srcRepl).read() == "rewritten int main(){ return 1; }\n")
+
+  pch1 = precompileHeader(cache, tool, compiler, forced, [], "c++",
+                          DepScanner(compiler, [], "c++"), False)
+  pch2 = precompileHeader(cache, tool, compiler, forced, [], "c++",
+                          DepScanner(compiler, [], "c++"), False)
+  write(nested, "#define NESTED 3\n")
+  pch3 = precompileHeader(cache, tool, compiler, forced, [], "c++",
+                          DepScanner(compiler, [], "c++"), False)
+  check("PCH is reused for unchanged headers", pch1 is not None and pch1 == pch2)
+  check("PCH is rebuilt after a nested header edit", pch3 is not None and pch3 != pch1)
+finally:
+  shutil.rmtree(top, ignore_errors=True)
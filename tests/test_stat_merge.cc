@@ -0,0 +1,326 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+
+#include <sstmac/common/stats/stat_merge.h>
+#include <sstmac/common/stats/stat_spyplot.h>
+#include <sprockit/factory.h>
+#include <sprockit/sim_parameters.h>
+#include <sprockit/spkt_printf.h>
+#include <cstdio>
+#include <random>
+
+using namespace sstmac;
+
+static const char* csv_header = "name,subId,bytes,count";
+
+/**
+ * The rows a single writer would have written for a group, each row begins with a newline
+ */
+static std::vector<std::string>
+csvRows(const std::string& group, int nrows)
+{
+  std::vector<std::string> rows;
+  for (int i=0; i < nrows; ++i){
+    rows.push_back(sprockit::sprintf("\n%s%d,%d,%d,%d", group.c_str(), i, i, 100*i, i % 7));
+  }
+  return rows;
+}
+
+static std::string
+csvFile(const std::vector<std::string>& rows, int start, int stop)
+{
+  //a writer with no statistics never opens its file
+  if (start == stop) return std::string();
+  std::string file = csv_header;
+  for (int i=start; i < stop; ++i){
+    file += rows[i];
+  }
+  return file;
+}
+
+/**
+ * Split the rows into contiguous partial files in writer order, writer 1 writes nothing
+ */
+static std::vector<std::string>
+csvPartials(const std::vector<std::string>& rows, int nparts)
+{
+  std::vector<std::string> parts;
+  int start = 0;
+  for (int p=0; p < nparts; ++p){
+    int stop = p == 1 ? start : start + (rows.size() - start) / (nparts - p);
+    if (p == nparts - 1) stop = rows.size();
+    parts.push_back(csvFile(rows, start, stop));
+    start = stop;
+  }
+  return parts;
+}
+
+static void
+check(bool success, const std::string& test)
+{
+  printf("%s on %s\n", success ? "SUCCESS" : "FAILURE", test.c_str());
+}
+
+void test_csv_thread_merge(StatisticOutput* csv)
+{
+  for (int nthread : {1, 2, 3, 5, 8}){
+    for (int max_threads : {1, 4}){
+      std::vector<std::string> groups = {"link", "nic"};
+      std::vector<PartialStatFiles> lists;
+      for (auto& group : groups){
+        PartialStatFiles list;
+        list.output = csv;
+        list.group = group;
+        list.contents = csvPartials(csvRows(group, 13), nthread);
+        lists.push_back(std::move(list));
+      }
+      treeMergeThreads(lists, max_threads);
+      bool success = true;
+      for (int g=0; g < groups.size(); ++g){
+        auto rows = csvRows(groups[g], 13);
+        success = success && lists[g].contents[0] == csvFile(rows, 0, rows.size());
+      }
+      check(success, sprockit::sprintf("csv merge of %d threads on %d threads", nthread, max_threads));
+    }
+  }
+}
+
+/**
+ * Run the rank tree with every rank in one process, ranks run from last to first
+ * so that every send has happened before the matching receive
+ */
+static void
+runRankTree(std::vector<PartialStatMap>& ranks)
+{
+  int nproc = ranks.size();
+  std::map<std::pair<int,int>, std::string> mailbox;
+  for (int me=nproc-1; me >= 0; --me){
+    bool writes = treeMergeRanks(me, nproc, ranks[me],
+      [&](int dst, const std::string& buf){ mailbox[std::make_pair(me,dst)] = buf; },
+      [&](int src, std::string& buf){ buf = mailbox.at(std::make_pair(src,me)); });
+    if (writes != (me == 0)){
+      printf("FAILURE: rank %d of %d %s the merged groups\n", me, nproc,
+             writes ? "holds" : "does not hold");
+    }
+  }
+}
+
+static void
+addPartial(PartialStatMap& stats, const std::string& group,
+           const std::string& output_name, const std::string& contents)
+{
+  SST::Params empty;
+  PartialStat& stat = stats[group];
+  stat.output = sprockit::create<StatisticOutput>("macro", output_name, empty);
+  stat.owned = true;
+  stat.outputName = output_name;
+  stat.fileRoot = "restart1." + group;
+  stat.contents = contents;
+}
+
+void test_csv_rank_merge()
+{
+  for (int nproc : {1, 2, 3, 5, 7, 8}){
+    auto link_rows = csvRows("link", 29);
+    auto nic_rows = csvRows("nic", 11);
+    auto link_parts = csvPartials(link_rows, nproc);
+    //only the odd ranks have nic statistics, rank 0 must create its output
+    auto nic_parts = csvPartials(nic_rows, nproc / 2);
+    std::vector<PartialStatMap> ranks(nproc);
+    for (int me=0; me < nproc; ++me){
+      addPartial(ranks[me], "link", "csv", link_parts[me]);
+      if (me % 2 == 1){
+        addPartial(ranks[me], "nic", "csv", nic_parts[me / 2]);
+      }
+    }
+    runRankTree(ranks);
+    bool success = ranks[0]["link"].contents == csvFile(link_rows, 0, link_rows.size());
+    if (nproc > 1){
+      success = success && ranks[0]["nic"].contents == csvFile(nic_rows, 0, nic_rows.size())
+                && ranks[0]["nic"].fileRoot == "restart1.nic";
+    }
+    check(success, sprockit::sprintf("csv merge of %d ranks", nproc));
+  }
+}
+
+using DenseMatrix = std::vector<std::vector<uint64_t>>;
+
+/**
+ * A traffic matrix with about a third of the entries zero and a nonzero last row
+ */
+static DenseMatrix
+randomMatrix(std::mt19937& rng, int n)
+{
+  DenseMatrix dense(n, std::vector<uint64_t>(n));
+  for (auto& row : dense){
+    for (auto& val : row){
+      val = rng() % 3 == 0 ? 0 : 1 + rng() % 1000;
+    }
+  }
+  dense[n-1][0] = 1;
+  return dense;
+}
+
+/**
+ * The packed CSR of a matrix, trailing empty rows are dropped like the writer does
+ */
+static std::string
+csrFile(const DenseMatrix& dense, int ncols)
+{
+  SpyplotCSR csr;
+  csr.ncols = ncols;
+  for (auto& row : dense){
+    for (int c=0; c < row.size(); ++c){
+      if (row[c]){
+        csr.cols.push_back(c);
+        csr.vals.push_back(row[c]);
+      }
+    }
+    csr.rowPtr.push_back(csr.cols.size());
+  }
+  while (csr.nrows() > 0 && csr.rowPtr[csr.nrows()-1] == csr.rowPtr.back()){
+    csr.rowPtr.pop_back();
+  }
+  //a writer with no traffic never opens its file
+  if (csr.nrows() == 0) return std::string();
+  std::string file;
+  csr.pack(file);
+  return file;
+}
+
+/**
+ * Scatter the entries of a matrix over partial matrices, some entries are split
+ * between two partials so that merging has to sum them, partial 1 gets nothing
+ */
+static std::vector<std::string>
+csrPartials(std::mt19937& rng, const DenseMatrix& dense, int nparts)
+{
+  int n = dense.size();
+  std::vector<DenseMatrix> parts(nparts, DenseMatrix(n, std::vector<uint64_t>(n)));
+  auto pick = [&]{
+    int p = rng() % nparts;
+    return nparts > 2 && p == 1 ? 0 : p;
+  };
+  for (int r=0; r < n; ++r){
+    for (int c=0; c < n; ++c){
+      uint64_t val = dense[r][c];
+      if (val > 1 && rng() % 3 == 0){
+        uint64_t split = 1 + rng() % (val - 1);
+        parts[pick()][r][c] += split;
+        val -= split;
+      }
+      parts[pick()][r][c] += val;
+    }
+  }
+  std::vector<std::string> files;
+  for (auto& part : parts){
+    files.push_back(csrFile(part, n));
+  }
+  return files;
+}
+
+void test_csr_thread_merge(StatisticOutput* csr)
+{
+  std::mt19937 rng(42);
+  for (int nthread : {1, 2, 3, 5, 8}){
+    for (int max_threads : {1, 4}){
+      std::vector<DenseMatrix> dense = { randomMatrix(rng, 23), randomMatrix(rng, 64) };
+      std::vector<PartialStatFiles> lists;
+      for (int g=0; g < dense.size(); ++g){
+        PartialStatFiles list;
+        list.output = csr;
+        list.group = sprockit::sprintf("spyplot%d", g);
+        list.contents = csrPartials(rng, dense[g], nthread);
+        lists.push_back(std::move(list));
+      }
+      treeMergeThreads(lists, max_threads);
+      bool success = true;
+      for (int g=0; g < dense.size(); ++g){
+        success = success && lists[g].contents[0] == csrFile(dense[g], dense[g].size());
+      }
+      check(success, sprockit::sprintf("csr merge of %d threads on %d threads", nthread, max_threads));
+    }
+  }
+}
+
+void test_csr_rank_merge()
+{
+  std::mt19937 rng(7);
+  for (int nproc : {1, 2, 3, 5, 7, 8}){
+    DenseMatrix traffic = randomMatrix(rng, 41);
+    DenseMatrix bytes = randomMatrix(rng, 17);
+    auto traffic_parts = csrPartials(rng, traffic, nproc);
+    //only the odd ranks have byte spyplots, rank 0 must create its output
+    auto bytes_parts = csrPartials(rng, bytes, std::max(nproc / 2, 1));
+    std::vector<PartialStatMap> ranks(nproc);
+    for (int me=0; me < nproc; ++me){
+      addPartial(ranks[me], "traffic", "csr", traffic_parts[me]);
+      if (me % 2 == 1){
+        addPartial(ranks[me], "bytes", "csr", bytes_parts[me / 2]);
+      }
+    }
+    runRankTree(ranks);
+    bool success = ranks[0]["traffic"].contents == csrFile(traffic, traffic.size());
+    if (nproc > 1){
+      success = success && ranks[0]["bytes"].contents == csrFile(bytes, bytes.size());
+    }
+    check(success, sprockit::sprintf("csr merge of %d ranks", nproc));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  SST::Params empty;
+  StatisticOutput* csv = sprockit::create<StatisticOutput>("macro", "csv", empty);
+  test_csv_thread_merge(csv);
+  test_csv_rank_merge();
+  delete csv;
+
+  StatisticOutput* csr = sprockit::create<StatisticOutput>("macro", "csr", empty);
+  test_csr_thread_merge(csr);
+  test_csr_rank_merge();
+  delete csr;
+  return 0;
+}